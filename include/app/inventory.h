@@ -3,11 +3,18 @@
 
 #include "list/XArrayList.h"
 #include "list/DLinkedList.h"
+#include "hash/StringDictionary.h"
+#include "hash/xMap.h"
+#include "heap/Heap.h"
+#include "util/MemLib.h"
+#include "util/SortLib.h"
 #include <sstream>
 #include <string>
 #include <iostream>
 #include <iomanip>
 #include <stdexcept>
+#include <limits>
+#include <cstring>
 
 using namespace std;
 
@@ -23,6 +30,8 @@ public:
     List1D(int num_elements);
     List1D(const T *array, int num_elements);
     List1D(const List1D<T> &other);
+    // move: takes the list of other (no copy); other is left empty (no list until its next add)
+    List1D(List1D<T> &&other) noexcept;
     virtual ~List1D();
 
     int size() const;
@@ -32,6 +41,7 @@ public:
     string toString() const;
     // = operator overloading (not in the original code)
     List1D<T>& operator=(const List1D<T>& other);
+    List1D<T>& operator=(List1D<T>&& other) noexcept;
     // define in the class to avoid warning
     friend ostream &operator<<(ostream &os, const List1D<T> &list) {
         return os << list.toString();
@@ -39,16 +49,33 @@ public:
 };
 
 // -------------------- List2D --------------------
+/*
+ * List2D keeps its cells in compressed sparse row (CSR) form: one array holds the
+ * cells of all the rows, and each row is a (start, length) slice of it. Rows are
+ * stored one after the other. setRow on an existing row writes the new cells at
+ * the end of the array (the overflow area) and leaves the old ones stale; the
+ * array is compacted once half of it is stale. So get(row, col) is O(1), and a
+ * scan of the whole matrix reads memory in order.
+ */
 template <typename T>
 class List2D
 {
 private:
-    IList<IList<T> *> *pMatrix;
+    T *values;         // the cells (see util/MemLib.h: [0, valueCount) are constructed, stale ones included)
+    int valueCount;    // slots of values in use
+    int valueCapacity; // slots of values
+    int *rowStart;     // rowStart[r]: first cell of row r in values
+    int *rowLength;    // rowLength[r]: number of cells of row r
+    int numRows;       // number of rows
+    int rowCapacity;   // slots of rowStart and rowLength
+    int staleCount;    // cells of values that belong to no row (see setRow)
 
 public:
     List2D();
     List2D(List1D<T> *array, int num_rows);
     List2D(const List2D<T> &other);
+    // move: takes the cells of other (no copy); other is left empty
+    List2D(List2D<T> &&other) noexcept;
     virtual ~List2D();
 
     int rows() const;
@@ -58,10 +85,21 @@ public:
     string toString() const;
     // = operator overloading (not in the original code)
     List2D<T>& operator=(const List2D<T>& other);
+    List2D<T>& operator=(List2D<T>&& other) noexcept;
     // define in the class to avoid warning
     friend ostream &operator<<(ostream &os, const List2D<T> &matrix) {
         return os << matrix.toString();
     }
+
+private:
+    void ensureValueCapacity(int minCapacity);
+    void ensureRowCapacity(int minCapacity);
+    int appendCells(const List1D<T> &row); // returns the start of the new cells
+    void compact();                        // drops the stale cells, puts the rows back in order
+    void init();
+    void copyFrom(const List2D<T> &other); // this: empty (see init)
+    void moveFrom(List2D<T> &other) noexcept;
+    void removeInternalData();
 };
 
 // original version
@@ -104,30 +142,351 @@ struct InventoryAttribute
     }
 };
 
+// -------------------- InventoryColumns --------------------
+/*
+ * InventoryColumns: the storage of InventoryManager, one array per field
+ * (struct of arrays) instead of one object per product:
+ *  + names[r], quantities[r]: product r
+ *  + one Column per attribute name: values[r] is the value of product r, NaN when
+ *      product r does not have this attribute (or has it with the value NaN, which
+ *      matches no filter either: the attributes of a product come from the layout);
+ *      the k-th attribute named "x" of a product goes to column ("x", k), so a
+ *      product may repeat a name
+ *  + attribute names are interned (see hash/StringDictionary.h): a column keeps the
+ *      id of its name, and finding the column of a name is one hash lookup
+ *  + the attributes of product r, in their original order, are the column ids
+ *      layoutColumns[layoutStart[r] .. layoutStart[r + 1])
+ * Every per-product array has "capacity" slots; slots past the last product hold
+ * NaN (values), so a new product only writes its own attributes.
+ * A filter on one attribute reads its column(s) and the quantities only
+ * (see InventoryManager::query).
+ *
+ * A column may also be indexed (see createIndex): its products, sorted by
+ * (value, quantity, row), in one array kept up to date by addRow, removeRows and
+ * setQuantity; a range of values is then found by binary search. addRow and
+ * removeRows move the tail of the array (O(n)); setQuantity moves only the entries
+ * of the same value between the old and the new position (see indexMove).
+ *
+ * removeRow only clears the bit of the row in "live" (a tombstone): no other row
+ * moves, so a row number stays valid while products are removed. The data of
+ * removed rows stays until compact() (see compactIfSparse). The index-th product
+ * is the index-th live row (see rowOf).
+ */
+class InventoryColumns
+{
+public:
+    struct IndexEntry
+    {
+        double value;
+        int quantity;
+        int row;
+
+        // comparisons and output, for the containers (XArrayList, Heap) that hold entries
+        bool operator==(const IndexEntry &other) const
+        {
+            return value == other.value && quantity == other.quantity && row == other.row;
+        }
+        bool operator<(const IndexEntry &other) const
+        {
+            return indexLess(*this, other);
+        }
+        bool operator>(const IndexEntry &other) const
+        {
+            return indexLess(other, *this);
+        }
+        friend ostream &operator<<(ostream &os, const IndexEntry &entry)
+        {
+            return os << "(" << entry.value << ", " << entry.quantity << ", " << entry.row << ")";
+        }
+    };
+    /* indexLess(lhs, rhs): the order of an index, and of the result of a query */
+    static bool indexLess(const IndexEntry &lhs, const IndexEntry &rhs)
+    {
+        if (lhs.value != rhs.value)
+            return lhs.value < rhs.value;
+        if (lhs.quantity != rhs.quantity)
+            return lhs.quantity < rhs.quantity;
+        return lhs.row < rhs.row;
+    }
+    struct Column
+    {
+        int nameId;         // see attributeNames
+        int occurrence;     // holds the occurrence-th attribute with this name of each product (0: the first)
+        int nextOccurrence; // id of the column (name, occurrence + 1); -1: none
+        double *values;     // values[r]: value for product r (NaN: absent)
+        IndexEntry *index;  // products having a (non-NaN) value, sorted; nullptr: not indexed
+        int indexSize;      // entries in index
+        int indexCapacity;  // slots of index
+    };
+
+    static const int MAX_REMOVED_PERCENT = 25; // see compactIfSparse
+
+private:
+    int count;                       // number of rows: products, removed or not
+    int capacity;                    // slots of names, quantities and of the values of every column
+    string *names;                   // product names (see util/MemLib.h: only [0, count) are constructed)
+    int *quantities;                 // product quantities
+    int *layoutStart;                // capacity + 1 slots: product r owns layoutColumns[layoutStart[r] .. layoutStart[r + 1])
+    int *layoutColumns;              // column ids of the attributes, product after product
+    int layoutCapacity;              // slots of layoutColumns
+    Column **columns;                // columns[id]
+    int numColumns;                  // number of columns
+    int columnCapacity;              // slots of columns
+    StringDictionary attributeNames; // attribute name <-> name id
+    int *nameColumns;                // nameColumns[nameId]: id of the column (name, 0); -1: none
+    int nameCapacity;                // slots of nameColumns
+    unsigned long long *live;        // bit r: row r is a product (0: removed, see removeRow)
+    int *liveCounts;                 // Fenwick tree: live rows per word of "live" (see rowOf)
+    int numRemoved;                  // removed rows in [0, count)
+
+public:
+    InventoryColumns();
+    InventoryColumns(const InventoryColumns &other);
+    InventoryColumns(InventoryColumns &&other) noexcept; // other is left empty
+    InventoryColumns &operator=(const InventoryColumns &other);
+    InventoryColumns &operator=(InventoryColumns &&other) noexcept;
+    ~InventoryColumns();
+
+    /* size(): number of products
+     * rowCount(): rows 0 .. rowCount() - 1, removed ones included
+     */
+    int size() const
+    {
+        return this->count - this->numRemoved;
+    }
+    int rowCount() const
+    {
+        return this->count;
+    }
+    bool isLive(int row) const
+    {
+        return (this->live[row >> 6] >> (row & 63)) & 1ULL;
+    }
+    /* rowOf(index): row of the index-th product; O(1) while no row is removed, else O(log n)
+     * nextRow(row): first product row after row (rowCount() if none); nextRow(-1): the first
+     */
+    int rowOf(int index) const;
+    int nextRow(int row) const;
+    const string &name(int row) const
+    {
+        return this->names[row];
+    }
+    int quantity(int row) const
+    {
+        return this->quantities[row];
+    }
+    void setQuantity(int row, int quantity);
+    int attributeCount(int row) const
+    {
+        return this->layoutStart[row + 1] - this->layoutStart[row];
+    }
+    InventoryAttribute attribute(int row, int k) const;
+    List1D<InventoryAttribute> getRow(int row) const;
+    /* attributeColumn(row, k): id of the column holding the k-th attribute of row
+     */
+    int attributeColumn(int row, int k) const
+    {
+        return this->layoutColumns[this->layoutStart[row] + k];
+    }
+
+    void addRow(const List1D<InventoryAttribute> &attributes, const string &name, int quantity);
+    /* removeRow(row): removes the product of a live row, O(log n); no row moves
+     */
+    void removeRow(int row);
+    /* removeRows(rows): drops the rows rows.get(0) < rows.get(1) < ... (live or not) in one
+     *  sweep over the table; the other rows move down, in order. Only the rows from
+     *  rows.get(0) on move: O(rowCount() + (rowCount() - rows.get(0)) * columns + index entries)
+     * compact(): drops every removed row
+     * compactIfSparse(): compact() when more than MAX_REMOVED_PERCENT % of the rows are
+     *  removed (the cost of a compaction is then spread over as many removeRow)
+     */
+    void removeRows(XArrayList<int> &rows);
+    void compact();
+    void compactIfSparse();
+    /* rowHash(row), sameRow(lhs, rhs): same name and the same attributes, in the same
+     *  order (as InventoryAttribute::operator==: an attribute valued NaN matches nothing)
+     */
+    unsigned int rowHash(int row) const;
+    bool sameRow(int lhs, int rhs) const;
+    void clear();
+
+    /* findColumn(name, occurrence): id of the column ("name", occurrence); -1 if none
+     */
+    int findColumn(const string &name, int occurrence) const;
+    int columnCount() const
+    {
+        return this->numColumns;
+    }
+    const Column &column(int id) const
+    {
+        return *this->columns[id];
+    }
+    const string &columnName(int id) const
+    {
+        return this->attributeNames.get(this->columns[id]->nameId);
+    }
+    const int *quantityData() const
+    {
+        return this->quantities;
+    }
+    const unsigned long long *liveData() const
+    {
+        return this->live;
+    }
+
+    /* createIndex(name): indexes the column (name, 0), created if needed; returns its id
+     * dropIndex(id): frees the index of column id (if any)
+     * indexRange(id, minValue, maxValue, from, to): column(id).index[from .. to) are
+     *  the entries with minValue <= value <= maxValue (O(log n))
+     */
+    int createIndex(const string &name);
+    void dropIndex(int id);
+    void indexRange(int id, double minValue, double maxValue, int &from, int &to) const;
+
+private:
+    static int bitmapWords(int capacity)
+    {
+        return (capacity + 63) / 64;
+    }
+    static void moveBit(unsigned long long *bits, int from, int to);
+    void rebuildLiveCounts();
+    void addLiveCount(int row, int delta);
+    void ensureCapacity(int minCapacity);
+    void ensureLayoutCapacity(int minCapacity);
+    void ensureNameCapacity(int minCapacity);
+    int columnOf(int nameId, int occurrence) const;
+    int addColumn(int nameId, int occurrence);
+    static int indexPosition(const Column &column, const IndexEntry &entry); // first entry not less than "entry"
+    static void ensureIndexCapacity(Column *pColumn, int minCapacity);
+    static void indexInsert(Column *pColumn, const IndexEntry &entry);     // capacity must be enough
+    static void indexMove(Column *pColumn, const IndexEntry &oldEntry, const IndexEntry &newEntry);
+    void init();
+    void copyFrom(const InventoryColumns &other);
+    void moveFrom(InventoryColumns &other) noexcept; // this: empty (see init)
+    void removeInternalData();
+};
+
+// -------------------- AttributeRowView --------------------
+/*
+ * AttributeRowView: the attributes of one product, read in place (no copy, no
+ * allocation): name(k) refers to the interned name, value(k) to the column.
+ *  For example:
+ *      AttributeRowView attributes = inventory.getProductAttributesView(i);
+ *      for (int k = 0; k < attributes.size(); k++)
+ *          cout << attributes.name(k) << ": " << attributes.value(k) << endl;
+ * A view is valid until the inventory is modified.
+ */
+class AttributeRowView
+{
+private:
+    const InventoryColumns *pTable;
+    int row;
+
+public:
+    AttributeRowView(const InventoryColumns *pTable, int row)
+    {
+        this->pTable = pTable;
+        this->row = row;
+    }
+    int size() const
+    {
+        return pTable->attributeCount(row);
+    }
+    const string &name(int k) const
+    {
+        checkIndex(k);
+        return pTable->columnName(pTable->attributeColumn(row, k));
+    }
+    double value(int k) const
+    {
+        checkIndex(k);
+        return pTable->column(pTable->attributeColumn(row, k)).values[row];
+    }
+    /* get(k): a copy of the k-th attribute, as in getProductAttributes(i).get(k)
+     */
+    InventoryAttribute get(int k) const
+    {
+        return InventoryAttribute(name(k), value(k));
+    }
+    List1D<InventoryAttribute> toList() const
+    {
+        return pTable->getRow(row);
+    }
+
+private:
+    void checkIndex(int k) const
+    {
+        if (k < 0 || k >= size())
+            throw out_of_range("Index is out of range!");
+    }
+};
+
 // -------------------- InventoryManager --------------------
 class InventoryManager
 {
 private:
-    List2D<InventoryAttribute> attributesMatrix;
-    List1D<string> productNames;
-    List1D<int> quantities;
+    InventoryColumns table; // names, quantities and attributes, column by column
 
 public:
+    class Iterator; // forward declaration
+
     InventoryManager();
+    // product i: row i of matrix, names.get(i), quantities.get(i);
+    // throws invalid_argument if matrix.rows(), names.size() and quantities.size() differ
     InventoryManager(const List2D<InventoryAttribute> &matrix,
                      const List1D<string> &names,
                      const List1D<int> &quantities);
     InventoryManager(const InventoryManager &other);
+    // move: takes the products of other (no copy); other is left empty
+    InventoryManager(InventoryManager &&other) noexcept;
+    InventoryManager &operator=(const InventoryManager &other);
+    InventoryManager &operator=(InventoryManager &&other) noexcept;
     int size() const;
     List1D<InventoryAttribute> getProductAttributes(int index) const;
     string getProductName(int index) const;
+    /* getProductAttributesView(index), getProductNameView(index): the same data as
+     *  getProductAttributes and getProductName, without copying it; valid until the
+     *  inventory is modified
+     */
+    AttributeRowView getProductAttributesView(int index) const;
+    const string &getProductNameView(int index) const;
     int getProductQuantity(int index) const;
     void updateQuantity(int index, int newQuantity);
     void addProduct(const List1D<InventoryAttribute> &attributes, const string &name, int quantity);
     void removeProduct(int index);
+    /* removeProducts(indices): removes the products at these indices (positions before
+     *  the call, in any order, repeats allowed), then compacts the storage once.
+     *  Throws out_of_range, with nothing removed, if an index is invalid.
+     */
+    void removeProducts(const List1D<int> &indices);
+    /* compact(): frees the space of removed products now (see Iterator::remove)
+     */
+    void compact();
 
     List1D<string> query(string attributeName, const double &minValue,
                          const double &maxValue, int minQuantity, bool ascending) const;
+    /* query(..., limit): the first "limit" products of query(...) only; cheaper than
+     *  the full query when limit is small (O(m log limit) for m matching products)
+     */
+    List1D<string> query(string attributeName, const double &minValue,
+                         const double &maxValue, int minQuantity, bool ascending,
+                         int limit) const;
+
+    /* createIndex(attributeName): keeps the products sorted by the value of attributeName,
+     *  so that query(attributeName, ...) finds its range by binary search instead of
+     *  reading the whole column. The index is one sorted array, so writes pay for it:
+     *  + addProduct: O(n) per index on an attribute of the product (the entries after
+     *      the new one move by one slot)
+     *  + updateQuantity: O(log n + k) per such index, k the products with the same
+     *      value and a quantity between the old and the new one
+     *  + removeProduct: nothing until the next compaction, which is O(n) per index
+     *  Worth it for attributes that are queried often in an inventory that is read
+     *  more than it grows; with many indexes, every addProduct moves many entries.
+     *  (Used by query only while no product has attributeName more than once.)
+     */
+    void createIndex(const string &attributeName);
+    void dropIndex(const string &attributeName);
+    bool hasIndex(const string &attributeName) const;
 
     void removeDuplicates();
 
@@ -142,6 +501,118 @@ public:
     List1D<string> getProductNames() const;
     List1D<int> getQuantities() const;
     string toString() const;
+
+    Iterator begin()
+    {
+        return Iterator(this, this->table.nextRow(-1));
+    }
+    Iterator end()
+    {
+        return Iterator(this, this->table.rowCount());
+    }
+
+    //////////////////////////////////////////////////////////////////////
+    ////////////////////////  INNER CLASSES DEFNITION ////////////////////
+    //////////////////////////////////////////////////////////////////////
+    // Iterator: BEGIN
+    /*
+     * Iterator: visits the products in order. it.remove() leaves a tombstone (see
+     * InventoryColumns), so no other product moves and the iteration goes on; the
+     * space is reclaimed by the next removeProduct, removeProducts, removeDuplicates
+     * or compact(), which must not be called during the iteration.
+     *  For example:
+     *      for (InventoryManager::Iterator it = inventory.begin(); it != inventory.end(); it++)
+     *          if (it.quantity() == 0)
+     *              it.remove();
+     */
+    class Iterator
+    {
+    private:
+        InventoryManager *pManager;
+        int row;
+
+    public:
+        Iterator(InventoryManager *pManager = 0, int row = 0)
+        {
+            this->pManager = pManager;
+            this->row = row;
+        }
+        const string &name() const
+        {
+            return pManager->table.name(row);
+        }
+        int quantity() const
+        {
+            return pManager->table.quantity(row);
+        }
+        List1D<InventoryAttribute> attributes() const
+        {
+            return pManager->table.getRow(row);
+        }
+        void updateQuantity(int newQuantity)
+        {
+            pManager->table.setQuantity(row, newQuantity);
+        }
+        void remove()
+        {
+            pManager->table.removeRow(row); // ++ goes on from this row
+        }
+
+        bool operator!=(const Iterator &iterator)
+        {
+            return row != iterator.row;
+        }
+        // Prefix ++ overload
+        Iterator &operator++()
+        {
+            row = pManager->table.nextRow(row);
+            return *this;
+        }
+        // Postfix ++ overload
+        Iterator operator++(int)
+        {
+            Iterator iterator = *this;
+            ++*this;
+            return iterator;
+        }
+    };
+    // Iterator: END
+
+private:
+    // key of xMap for removeDuplicates: a product of "table", compared by name and attributes
+    struct DuplicateKey
+    {
+        const InventoryColumns *table;
+        int row;
+        unsigned int hash; // table->rowHash(row)
+
+        bool operator==(const DuplicateKey &other) const
+        {
+            return this->hash == other.hash && this->table->sameRow(this->row, other.row);
+        }
+        friend ostream &operator<<(ostream &os, const DuplicateKey &key)
+        {
+            return os << key.row;
+        }
+    };
+    static int duplicateKeyHash(DuplicateKey &key, int capacity)
+    {
+        return (int)(key.hash % (unsigned int)capacity);
+    }
+    static bool duplicateKeyEqual(DuplicateKey &lhs, DuplicateKey &rhs)
+    {
+        return lhs == rhs;
+    }
+
+    // Heap comparators for query(..., limit): the match to drop first is on top
+    static int worstFirstAscending(InventoryColumns::IndexEntry &lhs, InventoryColumns::IndexEntry &rhs)
+    {
+        return InventoryColumns::indexLess(rhs, lhs) ? -1 : InventoryColumns::indexLess(lhs, rhs) ? 1 : 0;
+    }
+    static int worstFirstDescending(InventoryColumns::IndexEntry &lhs, InventoryColumns::IndexEntry &rhs)
+    {
+        return worstFirstAscending(rhs, lhs);
+    }
 };
 
 // -------------------- List1D Method Definitions --------------------
@@ -174,11 +645,18 @@ List1D<T>::List1D(const List1D<T> &other)
 {
     // TODO
     this->pList = new XArrayList<T>();
-    for (int i = 0; i < other.pList->size(); i++) {
-        this->pList->add(other.pList->get(i));
+    for (int i = 0; i < other.size(); i++) {
+        this->pList->add(other.get(i));
     }
 }
 
+template <typename T>
+List1D<T>::List1D(List1D<T> &&other) noexcept
+{
+    this->pList = other.pList;
+    other.pList = nullptr;
+}
+
 template <typename T>
 List1D<T>::~List1D()
 {
@@ -192,7 +670,8 @@ template <typename T>
 int List1D<T>::size() const
 {
     // TODO
-    return this->pList->size();
+    // no list: moved from
+    return (this->pList != nullptr) ? this->pList->size() : 0;
 }
 
 template <typename T>
@@ -200,6 +679,9 @@ T List1D<T>::get(int index) const
 {
     // TODO
     // check Index already implemented in get itself
+    if (this->pList == nullptr) {
+        throw out_of_range("Index is out of range!");
+    }
     return this->pList->get(index);
 }
 
@@ -207,7 +689,7 @@ template <typename T>
 void List1D<T>::set(int index, T value)
 {
     // TODO
-    if (index < 0 || index >= this->pList->size()) {
+    if (index < 0 || index >= this->size()) {
         throw out_of_range("Index is out of range!");
     }
     
@@ -219,6 +701,9 @@ template <typename T>
 void List1D<T>::add(const T &value)
 {
     // TODO
+    if (this->pList == nullptr) {
+        this->pList = new XArrayList<T>();
+    }
     this->pList->add(value);
 }
 
@@ -226,6 +711,9 @@ template <typename T>
 string List1D<T>::toString() const
 {
     // TODO
+    if (this->pList == nullptr) {
+        return "[]";
+    }
     return this->pList->toString();
 }
 
@@ -244,6 +732,18 @@ List1D<T>& List1D<T>::operator=(const List1D<T>& other) {
     }
     return *this;
 }
+
+template <typename T>
+List1D<T>& List1D<T>::operator=(List1D<T>&& other) noexcept {
+    if (this != &other) {
+        if (pList != nullptr) {
+            delete pList;
+        }
+        pList = other.pList;
+        other.pList = nullptr;
+    }
+    return *this;
+}
 // template <typename T>
 // ostream &operator<<(ostream &os, const List1D<T> &list)
 // {
@@ -256,24 +756,32 @@ template <typename T>
 List2D<T>::List2D()
 {
     // TODO
-    this->pMatrix = new DLinkedList<IList<T> *>();
+    init();
 }
 
 template <typename T>
 List2D<T>::List2D(List1D<T> *array, int num_rows)
 {
     // TODO
-    this->pMatrix = new DLinkedList<IList<T> *>();
+    init();
 
-    // Copy each row into the matrix
+    // Copy each row into the matrix: one allocation for all the cells
+    int numCells = 0;
     for (int i = 0; i < num_rows; i++) {
-        // create a copy of each row to ensure I have my own data
-        IList<T> *rowCopy = new XArrayList<T>();
-        for (int j = 0; j < array[i].size(); j++) {
-            rowCopy->add(array[i].get(j));
+        numCells += array[i].size();
+    }
+    try {
+        ensureValueCapacity(numCells);
+        ensureRowCapacity(num_rows);
+        for (int i = 0; i < num_rows; i++) {
+            this->rowStart[i] = appendCells(array[i]);
+            this->rowLength[i] = array[i].size();
+            this->numRows = i + 1;
         }
-
-        this->pMatrix->add(rowCopy);
+    }
+    catch (...) {
+        removeInternalData();
+        throw;
     }
 }
 
@@ -282,42 +790,29 @@ List2D<T>::List2D(const List2D<T> &other)
 {
     // TODO
     // deep copy
-    this->pMatrix = new DLinkedList<IList<T> *>();
-
-    // Copy each row into the matrix
-    for (int i = 0; i < other.rows(); i++) {
-        IList<T> *rowCopy = new XArrayList<T>();
-
-        List1D<T> originalRow = other.getRow(i);
-        for (int j = 0; j < originalRow.size(); j++) {
-            rowCopy->add(originalRow.get(j));
-        }
+    init();
+    copyFrom(other);
+}
 
-        this->pMatrix->add(rowCopy);
-    }
+template <typename T>
+List2D<T>::List2D(List2D<T> &&other) noexcept
+{
+    init();
+    moveFrom(other);
 }
 
 template <typename T>
 List2D<T>::~List2D()
 {
     // TODO
-    // clean all the rows and then delete the matrix
-    if (this->pMatrix != nullptr) {
-        for (int i = 0; i < this->pMatrix->size(); i++) {
-            if (this->pMatrix->get(i) != nullptr) {
-                delete this->pMatrix->get(i);
-            }
-        }
-        delete this->pMatrix;
-        this->pMatrix = nullptr; // to prevent use after-free
-    }
+    removeInternalData();
 }
 
 template <typename T>
 int List2D<T>::rows() const
 {
     // TODO
-    return this->pMatrix->size();
+    return this->numRows;
 }
 
 template <typename T>
@@ -328,19 +823,22 @@ void List2D<T>::setRow(int rowIndex, const List1D<T> &row)
         throw out_of_range("Index is out of range!");
     }
 
-    IList<T> *newRow = new XArrayList<T>();
-    for (int i = 0; i < row.size(); i++) {
-        newRow->add(row.get(i));
-    }
-
     // if a row already exists at the index, replace it
     if (rowIndex < this->rows()) {
-        // to avoid memory leak
-        delete this->pMatrix->get(rowIndex);
-        this->pMatrix->get(rowIndex) = newRow;
+        // the new cells go to the overflow area; the old ones are stale
+        int start = appendCells(row);
+        this->staleCount += this->rowLength[rowIndex];
+        this->rowStart[rowIndex] = start;
+        this->rowLength[rowIndex] = row.size();
+        if (this->staleCount * 2 > this->valueCount) {
+            compact();
+        }
     } // case setRow(0, row) when rows() == 0
     else {
-        this->pMatrix->add(newRow);
+        ensureRowCapacity(this->numRows + 1);
+        this->rowStart[this->numRows] = appendCells(row);
+        this->rowLength[this->numRows] = row.size();
+        this->numRows++;
     }
 }
 
@@ -352,13 +850,11 @@ T List2D<T>::get(int rowIndex, int colIndex) const
         throw out_of_range("Index is out of range!");
     }
 
-    IList<T> *row = this->pMatrix->get(rowIndex);
-
-    if (colIndex < 0 || colIndex >= this->pMatrix->get(rowIndex)->size()) {
+    if (colIndex < 0 || colIndex >= this->rowLength[rowIndex]) {
         throw out_of_range("Index is out of range!");
     }
 
-    return row->get(colIndex);
+    return this->values[this->rowStart[rowIndex] + colIndex];
 }
 
 template <typename T>
@@ -368,14 +864,14 @@ List1D<T> List2D<T>::getRow(int rowIndex) const
     if (rowIndex < 0 || rowIndex >= this->rows()) {
         throw out_of_range("Index is out of range!");
     }
-    
-    List1D<T> result;
-    IList<T> *row = this->pMatrix->get(rowIndex);
-    
-    for (int i = 0; i < row->size(); i++) {
-        result.add(row->get(i));
+
+    List1D<T> result(this->rowLength[rowIndex]);
+    const T *row = this->values + this->rowStart[rowIndex];
+
+    for (int i = 0; i < this->rowLength[rowIndex]; i++) {
+        result.add(row[i]);
     }
-    
+
     return result;
 }
 
@@ -393,17 +889,17 @@ string List2D<T>::toString() const
             ss << ", ";
         }
 
-        IList<T> *row = this->pMatrix->get(i);
+        const T *row = this->values + this->rowStart[i];
 
         // format the row
         ss << "[";
-        for (int j = 0; j < row->size(); j++) {
+        for (int j = 0; j < this->rowLength[i]; j++) {
             // add separator between elements
             if (j > 0) {
                 ss << ", ";
             }
 
-            ss << row->get(j);
+            ss << row[j];
         }
         ss << "]";
     }
@@ -415,25 +911,152 @@ string List2D<T>::toString() const
 template<typename T>
 List2D<T>& List2D<T>::operator=(const List2D<T>& other) {
     if (this != &other) {
-        // Free existing data
-        if (pMatrix != nullptr) {
-            for (int i = 0; i < pMatrix->size(); i++) {
-                delete pMatrix->get(i);
-            }
-            delete pMatrix;
+        // Free existing data, then copy the cells
+        removeInternalData();
+        copyFrom(other);
+    }
+    return *this;
+}
+
+template<typename T>
+List2D<T>& List2D<T>::operator=(List2D<T>&& other) noexcept {
+    if (this != &other) {
+        removeInternalData();
+        moveFrom(other);
+    }
+    return *this;
+}
+
+template <typename T>
+void List2D<T>::ensureValueCapacity(int minCapacity)
+{
+    if (minCapacity <= this->valueCapacity) {
+        return;
+    }
+    int newCapacity = (this->valueCapacity > 0) ? this->valueCapacity : 16;
+    while (newCapacity < minCapacity) {
+        newCapacity *= 2;
+    }
+    this->values = reallocRaw(this->values, this->valueCount, this->valueCapacity, newCapacity);
+    this->valueCapacity = newCapacity;
+}
+
+template <typename T>
+void List2D<T>::ensureRowCapacity(int minCapacity)
+{
+    if (minCapacity <= this->rowCapacity) {
+        return;
+    }
+    int newCapacity = (this->rowCapacity > 0) ? this->rowCapacity : 16;
+    while (newCapacity < minCapacity) {
+        newCapacity *= 2;
+    }
+    this->rowStart = reallocRaw(this->rowStart, this->numRows, this->rowCapacity, newCapacity);
+    this->rowLength = reallocRaw(this->rowLength, this->numRows, this->rowCapacity, newCapacity);
+    this->rowCapacity = newCapacity;
+}
+
+template <typename T>
+int List2D<T>::appendCells(const List1D<T> &row)
+{
+    // all or nothing: on failure, the cells already appended are destroyed
+    int start = this->valueCount;
+    ensureValueCapacity(start + row.size());
+    try {
+        for (int i = 0; i < row.size(); i++) {
+            new (&this->values[this->valueCount]) T(row.get(i));
+            this->valueCount++;
         }
-        // Re-create and copy elements
-        pMatrix = new DLinkedList<IList<T>*>();
-        for (int i = 0; i < other.rows(); i++) {
-            IList<T>* newRow = new XArrayList<T>();
-            List1D<T> row = other.getRow(i);
-            for (int j = 0; j < row.size(); j++) {
-                newRow->add(row.get(j));
+    }
+    catch (...) {
+        destroyRange(this->values, start, this->valueCount);
+        this->valueCount = start;
+        throw;
+    }
+    return start;
+}
+
+template <typename T>
+void List2D<T>::compact()
+{
+    int numCells = this->valueCount - this->staleCount;
+    T *newValues = allocRaw<T>(numCells);
+    int position = 0;
+    for (int r = 0; r < this->numRows; r++) {
+        T *row = this->values + this->rowStart[r];
+        for (int i = 0; i < this->rowLength[r]; i++) {
+            new (&newValues[position + i]) T(std::move(row[i]));
+        }
+        this->rowStart[r] = position;
+        position += this->rowLength[r];
+    }
+    destroyRange(this->values, 0, this->valueCount);
+    freeRaw(this->values, this->valueCapacity);
+    this->values = newValues;
+    this->valueCount = numCells;
+    this->valueCapacity = numCells;
+    this->staleCount = 0;
+}
+
+template <typename T>
+void List2D<T>::init()
+{
+    this->values = nullptr;
+    this->valueCount = 0;
+    this->valueCapacity = 0;
+    this->rowStart = nullptr;
+    this->rowLength = nullptr;
+    this->numRows = 0;
+    this->rowCapacity = 0;
+    this->staleCount = 0;
+}
+
+template <typename T>
+void List2D<T>::copyFrom(const List2D<T> &other)
+{
+    // the copy is compact: rows in order, no stale cell; on failure, this is left empty
+    try {
+        ensureValueCapacity(other.valueCount - other.staleCount);
+        ensureRowCapacity(other.numRows);
+        for (int r = 0; r < other.numRows; r++) {
+            const T *row = other.values + other.rowStart[r];
+            this->rowStart[r] = this->valueCount;
+            for (int i = 0; i < other.rowLength[r]; i++) {
+                new (&this->values[this->valueCount]) T(row[i]);
+                this->valueCount++;
             }
-            pMatrix->add(newRow);
+            this->rowLength[r] = other.rowLength[r];
+            this->numRows = r + 1;
         }
     }
-    return *this;
+    catch (...) {
+        removeInternalData();
+        throw;
+    }
+}
+
+template <typename T>
+void List2D<T>::moveFrom(List2D<T> &other) noexcept
+{
+    this->values = other.values;
+    this->valueCount = other.valueCount;
+    this->valueCapacity = other.valueCapacity;
+    this->rowStart = other.rowStart;
+    this->rowLength = other.rowLength;
+    this->numRows = other.numRows;
+    this->rowCapacity = other.rowCapacity;
+    this->staleCount = other.staleCount;
+    other.init();
+}
+
+template <typename T>
+void List2D<T>::removeInternalData()
+{
+    destroyRange(this->values, 0, this->valueCount);
+    freeRaw(this->values, this->valueCapacity);
+    freeRaw(this->rowStart, this->rowCapacity);
+    freeRaw(this->rowLength, this->rowCapacity);
+    init();
 }
 // template <typename T>
 // ostream &operator<<(ostream &os, const List2D<T> &matrix)
@@ -442,6 +1065,705 @@ List2D<T>& List2D<T>::operator=(const List2D<T>& other) {
 //     return os << matrix.toString();
 // }
 
+// -------------------- InventoryColumns Method Definitions --------------------
+inline InventoryColumns::InventoryColumns()
+{
+    init();
+}
+
+inline InventoryColumns::InventoryColumns(const InventoryColumns &other)
+{
+    init();
+    copyFrom(other);
+}
+
+inline InventoryColumns &InventoryColumns::operator=(const InventoryColumns &other)
+{
+    if (this != &other) {
+        removeInternalData();
+        init();
+        copyFrom(other);
+    }
+    return *this;
+}
+
+inline InventoryColumns::InventoryColumns(InventoryColumns &&other) noexcept
+{
+    init();
+    moveFrom(other);
+}
+
+inline InventoryColumns &InventoryColumns::operator=(InventoryColumns &&other) noexcept
+{
+    if (this != &other) {
+        removeInternalData();
+        init();
+        moveFrom(other);
+    }
+    return *this;
+}
+
+inline InventoryColumns::~InventoryColumns()
+{
+    removeInternalData();
+}
+
+inline InventoryAttribute InventoryColumns::attribute(int row, int k) const
+{
+    int id = attributeColumn(row, k);
+    return InventoryAttribute(columnName(id), this->columns[id]->values[row]);
+}
+
+inline List1D<InventoryAttribute> InventoryColumns::getRow(int row) const
+{
+    List1D<InventoryAttribute> result;
+    int n = attributeCount(row);
+    for (int k = 0; k < n; k++) {
+        result.add(attribute(row, k));
+    }
+    return result;
+}
+
+inline void InventoryColumns::addRow(const List1D<InventoryAttribute> &attributes, const string &name, int quantity)
+{
+    int n = attributes.size();
+    ensureCapacity(this->count + 1);
+    ensureLayoutCapacity(this->layoutStart[this->count] + n);
+
+    // 1. find (or create) the column of every attribute: may throw, nothing is written yet
+    XArrayList<double> values(nullptr, nullptr, n);
+    XArrayList<int> nameIds(nullptr, nullptr, n);
+    XArrayList<int> ids(nullptr, nullptr, n);
+    for (int k = 0; k < n; k++) {
+        InventoryAttribute attribute = attributes.get(k);
+        values.add(attribute.value);
+        nameIds.add(this->attributeNames.intern(attribute.name));
+        ensureNameCapacity(this->attributeNames.size());
+        int occurrence = 0;
+        for (int j = 0; j < k; j++) {
+            if (nameIds.get(j) == nameIds.get(k)) {
+                occurrence++;
+            }
+        }
+        int id = columnOf(nameIds.get(k), occurrence);
+        ids.add((id != -1) ? id : addColumn(nameIds.get(k), occurrence));
+        Column *pColumn = this->columns[ids.get(k)];
+        if (pColumn->index != nullptr) {
+            ensureIndexCapacity(pColumn, pColumn->indexSize + 1);
+        }
+    }
+
+    // 2. write the product
+    new (&this->names[this->count]) string(name);
+    this->quantities[this->count] = quantity;
+    int start = this->layoutStart[this->count];
+    for (int k = 0; k < n; k++) {
+        Column *pColumn = this->columns[ids.get(k)];
+        pColumn->values[this->count] = values.get(k);
+        this->layoutColumns[start + k] = ids.get(k);
+        if (pColumn->index != nullptr && values.get(k) == values.get(k)) {
+            IndexEntry entry = {values.get(k), quantity, this->count};
+            indexInsert(pColumn, entry);
+        }
+    }
+    this->layoutStart[this->count + 1] = start + n;
+    this->live[this->count >> 6] |= 1ULL << (this->count & 63);
+    addLiveCount(this->count, 1);
+    this->count++;
+}
+
+inline void InventoryColumns::setQuantity(int row, int quantity)
+{
+    // the entries of the product move inside the indexes of its columns
+    for (int i = this->layoutStart[row]; i < this->layoutStart[row + 1]; i++) {
+        Column *pColumn = this->columns[this->layoutColumns[i]];
+        double value = pColumn->values[row];
+        if (pColumn->index != nullptr && value == value) {
+            IndexEntry oldEntry = {value, this->quantities[row], row};
+            IndexEntry newEntry = {value, quantity, row};
+            indexMove(pColumn, oldEntry, newEntry);
+        }
+    }
+    this->quantities[row] = quantity;
+}
+
+inline void InventoryColumns::removeRow(int row)
+{
+    // a tombstone: the row keeps its data, and its index entries, until the next compaction
+    this->live[row >> 6] &= ~(1ULL << (row & 63));
+    addLiveCount(row, -1);
+    this->numRemoved++;
+}
+
+inline void InventoryColumns::removeRows(XArrayList<int> &rows)
+{
+    if (rows.size() == 0) {
+        return;
+    }
+    // newRows[r]: position of product r once the rows are removed; -1: removed
+    int *newRows = allocRaw<int>(this->count);
+    for (int r = 0, k = 0, w = 0; r < this->count; r++) {
+        if (k < rows.size() && rows.get(k) == r) {
+            newRows[r] = -1;
+            k++;
+        }
+        else {
+            newRows[r] = w++;
+        }
+    }
+    int newCount = this->count - rows.size();
+    for (int k = 0; k < rows.size(); k++) {
+        this->numRemoved -= !isLive(rows.get(k));
+    }
+
+    // products only move down (w <= r): one pass, in place, from the first removed row
+    int first = rows.get(0);
+    int position = this->layoutStart[first];
+    for (int r = first; r < this->count; r++) {
+        int w = newRows[r];
+        if (w == -1) {
+            continue;
+        }
+        int from = this->layoutStart[r];
+        int width = this->layoutStart[r + 1] - from;
+        if (w != r) {
+            this->names[w] = std::move(this->names[r]);
+            this->quantities[w] = this->quantities[r];
+            moveBit(this->live, r, w);
+        }
+        if (width > 0) {
+            memmove(this->layoutColumns + position, this->layoutColumns + from, sizeof(int) * width);
+        }
+        this->layoutStart[w] = position;
+        position += width;
+    }
+    this->layoutStart[newCount] = position;
+    destroyRange(this->names, newCount, this->count);
+    for (int r = newCount; r < this->count; r++) {
+        this->live[r >> 6] &= ~(1ULL << (r & 63));
+    }
+
+    for (int id = 0; id < this->numColumns; id++) {
+        Column *pColumn = this->columns[id];
+        for (int r = first; r < this->count; r++) {
+            int w = newRows[r];
+            if (w == -1 || w == r) {
+                continue;
+            }
+            pColumn->values[w] = pColumn->values[r];
+        }
+        for (int r = newCount; r < this->count; r++) {
+            pColumn->values[r] = numeric_limits<double>::quiet_NaN();
+        }
+
+        // the indexes keep their order: only the rows change
+        if (pColumn->index != nullptr) {
+            int size = 0;
+            for (int i = 0; i < pColumn->indexSize; i++) {
+                int w = newRows[pColumn->index[i].row];
+                if (w != -1) {
+                    pColumn->index[size] = pColumn->index[i];
+                    pColumn->index[size++].row = w;
+                }
+            }
+            pColumn->indexSize = size;
+        }
+    }
+    freeRaw(newRows, this->count);
+    this->count = newCount;
+    rebuildLiveCounts();
+}
+
+inline void InventoryColumns::compact()
+{
+    if (this->numRemoved == 0) {
+        return;
+    }
+    XArrayList<int> rows(nullptr, nullptr, this->numRemoved);
+    for (int r = 0; r < this->count; r++) {
+        if (!isLive(r)) {
+            rows.add(r);
+        }
+    }
+    removeRows(rows);
+}
+
+inline void InventoryColumns::compactIfSparse()
+{
+    if ((long long)this->numRemoved * 100 > (long long)this->count * MAX_REMOVED_PERCENT) {
+        compact();
+    }
+}
+
+inline int InventoryColumns::rowOf(int index) const
+{
+    if (this->numRemoved == 0) {
+        return index;
+    }
+    // the word holding the product: walk down the Fenwick tree, skipping whole words
+    int words = bitmapWords(this->capacity);
+    int step = 1;
+    while (step * 2 <= words) {
+        step *= 2;
+    }
+    int word = 0;
+    for (; step > 0; step /= 2) {
+        if (word + step <= words && this->liveCounts[word + step] <= index) {
+            word += step;
+            index -= this->liveCounts[word];
+        }
+    }
+    // then the index-th set bit of the word
+    unsigned long long bits = this->live[word];
+    for (; index > 0; index--) {
+        bits &= bits - 1;
+    }
+    return (word << 6) + __builtin_ctzll(bits);
+}
+
+inline int InventoryColumns::nextRow(int row) const
+{
+    int r = row + 1;
+    if (r >= this->count) {
+        return this->count;
+    }
+    int word = r >> 6;
+    unsigned long long bits = this->live[word] & (~0ULL << (r & 63));
+    while (bits == 0) {
+        if (++word >= bitmapWords(this->count)) {
+            return this->count;
+        }
+        bits = this->live[word];
+    }
+    return (word << 6) + __builtin_ctzll(bits);
+}
+
+inline unsigned int InventoryColumns::rowHash(int row) const
+{
+    // FNV-1a over the name, then the columns and values of the attributes
+    unsigned int code = 2166136261u;
+    for (unsigned char ch : this->names[row]) {
+        code = (code ^ ch) * 16777619u;
+    }
+    for (int i = this->layoutStart[row]; i < this->layoutStart[row + 1]; i++) {
+        int id = this->layoutColumns[i];
+        double value = this->columns[id]->values[row];
+        unsigned long long bits;
+        value = (value == 0.0) ? 0.0 : value; // -0.0 == 0.0
+        memcpy(&bits, &value, sizeof(bits));
+        code = (code ^ (unsigned int)id) * 16777619u;
+        code = (code ^ (unsigned int)bits) * 16777619u;
+        code = (code ^ (unsigned int)(bits >> 32)) * 16777619u;
+    }
+    return code;
+}
+
+inline bool InventoryColumns::sameRow(int lhs, int rhs) const
+{
+    // same names of attributes in the same order <=> same columns (see Column::occurrence)
+    int width = attributeCount(lhs);
+    if (width != attributeCount(rhs) || this->names[lhs] != this->names[rhs]) {
+        return false;
+    }
+    const int *lhsColumns = this->layoutColumns + this->layoutStart[lhs];
+    const int *rhsColumns = this->layoutColumns + this->layoutStart[rhs];
+    for (int k = 0; k < width; k++) {
+        if (lhsColumns[k] != rhsColumns[k]
+            || this->columns[lhsColumns[k]]->values[lhs] != this->columns[rhsColumns[k]]->values[rhs]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline void InventoryColumns::clear()
+{
+    removeInternalData();
+    init();
+}
+
+inline int InventoryColumns::findColumn(const string &name, int occurrence) const
+{
+    int nameId = this->attributeNames.find(name);
+    return (nameId == -1) ? -1 : columnOf(nameId, occurrence);
+}
+
+inline int InventoryColumns::columnOf(int nameId, int occurrence) const
+{
+    int id = this->nameColumns[nameId];
+    for (; id != -1 && occurrence > 0; occurrence--) {
+        id = this->columns[id]->nextOccurrence;
+    }
+    return id;
+}
+
+inline int InventoryColumns::createIndex(const string &name)
+{
+    int nameId = this->attributeNames.intern(name);
+    ensureNameCapacity(this->attributeNames.size());
+    int id = columnOf(nameId, 0);
+    if (id == -1) {
+        id = addColumn(nameId, 0);
+    }
+    Column *pColumn = this->columns[id];
+    if (pColumn->index != nullptr) {
+        return id;
+    }
+
+    int size = 0;
+    for (int r = 0; r < this->count; r++) {
+        size += (pColumn->values[r] == pColumn->values[r]) && isLive(r);
+    }
+    IndexEntry *index = allocRaw<IndexEntry>((size > 0) ? size : 1);
+    int i = 0;
+    for (int r = 0; r < this->count; r++) {
+        if (pColumn->values[r] == pColumn->values[r] && isLive(r)) {
+            IndexEntry entry = {pColumn->values[r], this->quantities[r], r};
+            index[i++] = entry;
+        }
+    }
+    pdqSort(index, size, [](IndexEntry &lhs, IndexEntry &rhs) { return indexLess(lhs, rhs); });
+    pColumn->index = index;
+    pColumn->indexSize = size;
+    pColumn->indexCapacity = (size > 0) ? size : 1;
+    return id;
+}
+
+inline void InventoryColumns::dropIndex(int id)
+{
+    Column *pColumn = this->columns[id];
+    freeRaw(pColumn->index, pColumn->indexCapacity);
+    pColumn->index = nullptr;
+    pColumn->indexSize = pColumn->indexCapacity = 0;
+}
+
+inline void InventoryColumns::indexRange(int id, double minValue, double maxValue, int &from, int &to) const
+{
+    const Column *pColumn = this->columns[id];
+    // from: first value >= minValue; to: first value > maxValue
+    int low = 0, high = pColumn->indexSize;
+    while (low < high) {
+        int middle = low + (high - low) / 2;
+        if (pColumn->index[middle].value < minValue)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    from = low;
+    high = pColumn->indexSize;
+    while (low < high) {
+        int middle = low + (high - low) / 2;
+        if (pColumn->index[middle].value <= maxValue)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    to = low;
+}
+
+inline int InventoryColumns::indexPosition(const Column &column, const IndexEntry &entry)
+{
+    int low = 0, high = column.indexSize;
+    while (low < high) {
+        int middle = low + (high - low) / 2;
+        if (indexLess(column.index[middle], entry))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+inline void InventoryColumns::ensureIndexCapacity(Column *pColumn, int minCapacity)
+{
+    if (minCapacity <= pColumn->indexCapacity) {
+        return;
+    }
+    int newCapacity = 2 * pColumn->indexCapacity;
+    while (newCapacity < minCapacity) {
+        newCapacity *= 2;
+    }
+    pColumn->index = reallocRaw(pColumn->index, pColumn->indexSize, pColumn->indexCapacity, newCapacity);
+    pColumn->indexCapacity = newCapacity;
+}
+
+inline void InventoryColumns::indexInsert(Column *pColumn, const IndexEntry &entry)
+{
+    int position = indexPosition(*pColumn, entry);
+    memmove(pColumn->index + position + 1, pColumn->index + position,
+            sizeof(IndexEntry) * (pColumn->indexSize - position));
+    pColumn->index[position] = entry;
+    pColumn->indexSize++;
+}
+
+inline void InventoryColumns::indexMove(Column *pColumn, const IndexEntry &oldEntry, const IndexEntry &newEntry)
+{
+    // only the entries between the two positions shift by one: with the same value,
+    // these are the entries of equal value and a quantity in between
+    int from = indexPosition(*pColumn, oldEntry);
+    int to = indexPosition(*pColumn, newEntry);
+    if (to > from) {
+        to--; // the entries after "from" shift down into its slot
+        memmove(pColumn->index + from, pColumn->index + from + 1, sizeof(IndexEntry) * (to - from));
+    }
+    else {
+        memmove(pColumn->index + to + 1, pColumn->index + to, sizeof(IndexEntry) * (from - to));
+    }
+    pColumn->index[to] = newEntry;
+}
+
+inline void InventoryColumns::moveBit(unsigned long long *bits, int from, int to)
+{
+    unsigned long long bit = (bits[from >> 6] >> (from & 63)) & 1ULL;
+    bits[to >> 6] = (bits[to >> 6] & ~(1ULL << (to & 63))) | (bit << (to & 63));
+}
+
+inline void InventoryColumns::rebuildLiveCounts()
+{
+    // liveCounts[1 .. words]: O(words) bottom-up construction
+    int words = bitmapWords(this->capacity);
+    for (int i = 1; i <= words; i++) {
+        this->liveCounts[i] = __builtin_popcountll(this->live[i - 1]);
+    }
+    for (int i = 1; i <= words; i++) {
+        int parent = i + (i & -i);
+        if (parent <= words) {
+            this->liveCounts[parent] += this->liveCounts[i];
+        }
+    }
+}
+
+inline void InventoryColumns::addLiveCount(int row, int delta)
+{
+    int words = bitmapWords(this->capacity);
+    for (int i = (row >> 6) + 1; i <= words; i += i & -i) {
+        this->liveCounts[i] += delta;
+    }
+}
+
+inline void InventoryColumns::ensureCapacity(int minCapacity)
+{
+    if (minCapacity <= this->capacity) {
+        return;
+    }
+    int newCapacity = (this->capacity > 0) ? this->capacity : 16;
+    while (newCapacity < minCapacity) {
+        newCapacity *= 2;
+    }
+
+    this->names = reallocRaw(this->names, this->count, this->capacity, newCapacity);
+    this->quantities = reallocRaw(this->quantities, this->count, this->capacity, newCapacity);
+    this->layoutStart = reallocRaw(this->layoutStart, this->count + 1, this->capacity + 1, newCapacity + 1);
+    if (this->capacity == 0) {
+        this->layoutStart[0] = 0; // the first slot (see init)
+    }
+    for (int id = 0; id < this->numColumns; id++) {
+        Column *pColumn = this->columns[id];
+        pColumn->values = reallocRaw(pColumn->values, this->capacity, this->capacity, newCapacity);
+        for (int r = this->capacity; r < newCapacity; r++) {
+            pColumn->values[r] = numeric_limits<double>::quiet_NaN();
+        }
+    }
+    int oldWords = bitmapWords(this->capacity);
+    int newWords = bitmapWords(newCapacity);
+    this->live = reallocRaw(this->live, oldWords, oldWords, newWords);
+    for (int w = oldWords; w < newWords; w++) {
+        this->live[w] = 0;
+    }
+    int *liveCounts = allocRaw<int>(newWords + 1);
+    freeRaw(this->liveCounts, oldWords + 1);
+    this->liveCounts = liveCounts;
+    this->capacity = newCapacity;
+    rebuildLiveCounts();
+}
+
+inline void InventoryColumns::ensureLayoutCapacity(int minCapacity)
+{
+    if (minCapacity <= this->layoutCapacity) {
+        return;
+    }
+    int newCapacity = (this->layoutCapacity > 0) ? this->layoutCapacity : 64;
+    while (newCapacity < minCapacity) {
+        newCapacity *= 2;
+    }
+    this->layoutColumns = reallocRaw(this->layoutColumns, this->layoutStart[this->count],
+                                     this->layoutCapacity, newCapacity);
+    this->layoutCapacity = newCapacity;
+}
+
+inline void InventoryColumns::ensureNameCapacity(int minCapacity)
+{
+    if (minCapacity <= this->nameCapacity) {
+        return;
+    }
+    int newCapacity = (this->nameCapacity > 0) ? 2 * this->nameCapacity : 8;
+    while (newCapacity < minCapacity) {
+        newCapacity *= 2;
+    }
+    this->nameColumns = reallocRaw(this->nameColumns, this->nameCapacity, this->nameCapacity, newCapacity);
+    for (int nameId = this->nameCapacity; nameId < newCapacity; nameId++) {
+        this->nameColumns[nameId] = -1;
+    }
+    this->nameCapacity = newCapacity;
+}
+
+/* addColumn(nameId, occurrence): the column (name, occurrence - 1) must exist already
+ */
+inline int InventoryColumns::addColumn(int nameId, int occurrence)
+{
+    if (this->numColumns == this->columnCapacity) {
+        int newCapacity = (this->columnCapacity > 0) ? 2 * this->columnCapacity : 8;
+        this->columns = reallocRaw(this->columns, this->numColumns, this->columnCapacity, newCapacity);
+        this->columnCapacity = newCapacity;
+    }
+
+    Column *pColumn = new Column();
+    pColumn->nameId = nameId;
+    pColumn->occurrence = occurrence;
+    pColumn->nextOccurrence = -1;
+    pColumn->index = nullptr;
+    pColumn->indexSize = pColumn->indexCapacity = 0;
+    try {
+        pColumn->values = allocRaw<double>(this->capacity);
+    }
+    catch (...) {
+        delete pColumn;
+        throw;
+    }
+    for (int r = 0; r < this->capacity; r++) {
+        pColumn->values[r] = numeric_limits<double>::quiet_NaN();
+    }
+    this->columns[this->numColumns] = pColumn;
+    if (occurrence == 0) {
+        this->nameColumns[nameId] = this->numColumns;
+    }
+    else {
+        this->columns[columnOf(nameId, occurrence - 1)]->nextOccurrence = this->numColumns;
+    }
+    return this->numColumns++;
+}
+
+inline void InventoryColumns::init()
+{
+    this->count = 0;
+    this->capacity = 0;
+    this->names = nullptr;
+    this->quantities = nullptr;
+    this->layoutStart = nullptr; // allocated with the first row: an empty table owns no memory
+    this->layoutColumns = nullptr;
+    this->layoutCapacity = 0;
+    this->columns = nullptr;
+    this->numColumns = 0;
+    this->columnCapacity = 0;
+    this->nameColumns = nullptr;
+    this->nameCapacity = 0;
+    this->live = nullptr;
+    this->liveCounts = nullptr;
+    this->numRemoved = 0;
+}
+
+inline void InventoryColumns::copyFrom(const InventoryColumns &other)
+{
+    // this: empty (see init); on failure, it is left empty again
+    try {
+        ensureCapacity(other.count);
+        ensureLayoutCapacity((other.count > 0) ? other.layoutStart[other.count] : 0);
+        this->attributeNames = other.attributeNames;
+        ensureNameCapacity(other.attributeNames.size());
+        for (int id = 0; id < other.numColumns; id++) {
+            addColumn(other.columns[id]->nameId, other.columns[id]->occurrence);
+        }
+        for (int id = 0; id < other.numColumns; id++) {
+            const Column *pOther = other.columns[id];
+            if (pOther->index != nullptr) {
+                this->columns[id]->index = allocRaw<IndexEntry>(pOther->indexCapacity);
+                this->columns[id]->indexCapacity = pOther->indexCapacity;
+                this->columns[id]->indexSize = pOther->indexSize;
+            }
+        }
+        for (int r = 0; r < other.count; r++) {
+            new (&this->names[r]) string(other.names[r]);
+            this->count = r + 1; // names [0, r] are constructed
+        }
+    }
+    catch (...) {
+        removeInternalData();
+        init();
+        throw;
+    }
+    if (other.count == 0) {
+        return;
+    }
+    for (int id = 0; id < other.numColumns; id++) {
+        memcpy(this->columns[id]->values, other.columns[id]->values, sizeof(double) * other.count);
+    }
+    for (int id = 0; id < other.numColumns; id++) {
+        if (other.columns[id]->indexSize > 0) {
+            memcpy(this->columns[id]->index, other.columns[id]->index,
+                   sizeof(IndexEntry) * other.columns[id]->indexSize);
+        }
+    }
+    memcpy(this->quantities, other.quantities, sizeof(int) * other.count);
+    memcpy(this->live, other.live, sizeof(unsigned long long) * bitmapWords(other.count));
+    this->numRemoved = other.numRemoved;
+    rebuildLiveCounts();
+    memcpy(this->layoutStart, other.layoutStart, sizeof(int) * (other.count + 1));
+    if (other.layoutStart[other.count] > 0) {
+        memcpy(this->layoutColumns, other.layoutColumns, sizeof(int) * other.layoutStart[other.count]);
+    }
+}
+
+inline void InventoryColumns::moveFrom(InventoryColumns &other) noexcept
+{
+    // takes the buffers as they are: no allocation, no copy
+    this->count = other.count;
+    this->capacity = other.capacity;
+    this->names = other.names;
+    this->quantities = other.quantities;
+    this->layoutStart = other.layoutStart;
+    this->layoutColumns = other.layoutColumns;
+    this->layoutCapacity = other.layoutCapacity;
+    this->columns = other.columns;
+    this->numColumns = other.numColumns;
+    this->columnCapacity = other.columnCapacity;
+    this->attributeNames = std::move(other.attributeNames);
+    this->nameColumns = other.nameColumns;
+    this->nameCapacity = other.nameCapacity;
+    this->live = other.live;
+    this->liveCounts = other.liveCounts;
+    this->numRemoved = other.numRemoved;
+    other.init();
+}
+
+inline void InventoryColumns::removeInternalData()
+{
+    destroyRange(this->names, 0, this->count);
+    freeRaw(this->names, this->capacity);
+    freeRaw(this->quantities, this->capacity);
+    freeRaw(this->layoutStart, this->capacity + 1);
+    freeRaw(this->layoutColumns, this->layoutCapacity);
+    for (int id = 0; id < this->numColumns; id++) {
+        freeRaw(this->columns[id]->values, this->capacity);
+        freeRaw(this->columns[id]->index, this->columns[id]->indexCapacity);
+        delete this->columns[id];
+    }
+    freeRaw(this->columns, this->columnCapacity);
+    freeRaw(this->nameColumns, this->nameCapacity);
+    freeRaw(this->live, bitmapWords(this->capacity));
+    freeRaw(this->liveCounts, bitmapWords(this->capacity) + 1);
+    this->attributeNames.clear();
+    this->names = nullptr;
+    this->quantities = nullptr;
+    this->layoutStart = nullptr;
+    this->layoutColumns = nullptr;
+    this->columns = nullptr;
+    this->nameColumns = nullptr;
+    this->live = nullptr;
+    this->liveCounts = nullptr;
+    this->count = this->capacity = this->layoutCapacity = this->numColumns = this->columnCapacity = 0;
+    this->nameCapacity = this->numRemoved = 0;
+}
+
 // -------------------- InventoryManager Method Definitions --------------------
 inline InventoryManager::InventoryManager()
 {
@@ -454,27 +1776,42 @@ inline InventoryManager::InventoryManager(const List2D<InventoryAttribute> &matr
                                    const List1D<int> &quantities)
 {
     // TODO
-    // Do I need to validate the input ?
-    
-    // Deep copy (because List2D and List1D assignment operators)
-    this->attributesMatrix = matrix;
-    this->productNames = names;
-    this->quantities = quantities;
+    // one product per row: the three inputs must describe the same products
+    if (matrix.rows() != names.size() || names.size() != quantities.size()) {
+        throw invalid_argument("matrix, names and quantities must have the same size");
+    }
+    for (int i = 0; i < names.size(); i++) {
+        this->table.addRow(matrix.getRow(i), names.get(i), quantities.get(i));
+    }
 }
 
-inline InventoryManager::InventoryManager(const InventoryManager &other)
+inline InventoryManager::InventoryManager(const InventoryManager &other) : table(other.table)
 {
     // TODO
-    // Deep copy (because List2D and List1D assignment operators)
-    this->attributesMatrix = other.attributesMatrix;
-    this->productNames = other.productNames;
-    this->quantities = other.quantities;
+    // Deep copy (see InventoryColumns)
+}
+
+inline InventoryManager::InventoryManager(InventoryManager &&other) noexcept
+    : table(std::move(other.table))
+{
+}
+
+inline InventoryManager &InventoryManager::operator=(const InventoryManager &other)
+{
+    this->table = other.table;
+    return *this;
+}
+
+inline InventoryManager &InventoryManager::operator=(InventoryManager &&other) noexcept
+{
+    this->table = std::move(other.table);
+    return *this;
 }
 
 inline int InventoryManager::size() const
 {
     // TODO
-    return this->productNames.size();
+    return this->table.size();
 }
 
 inline List1D<InventoryAttribute> InventoryManager::getProductAttributes(int index) const
@@ -483,7 +1820,7 @@ inline List1D<InventoryAttribute> InventoryManager::getProductAttributes(int ind
     if (index < 0 || index >= this->size()) {
         throw out_of_range("Index is invalid!");
     }
-    return this->attributesMatrix.getRow(index);
+    return this->table.getRow(this->table.rowOf(index));
 
 }
 
@@ -493,7 +1830,23 @@ inline string InventoryManager::getProductName(int index) const
     if (index < 0 || index >= this->size()) {
         throw out_of_range("Index is invalid!");
     }
-    return this->productNames.get(index);
+    return this->table.name(this->table.rowOf(index));
+}
+
+inline AttributeRowView InventoryManager::getProductAttributesView(int index) const
+{
+    if (index < 0 || index >= this->size()) {
+        throw out_of_range("Index is invalid!");
+    }
+    return AttributeRowView(&this->table, this->table.rowOf(index));
+}
+
+inline const string &InventoryManager::getProductNameView(int index) const
+{
+    if (index < 0 || index >= this->size()) {
+        throw out_of_range("Index is invalid!");
+    }
+    return this->table.name(this->table.rowOf(index));
 }
 
 inline int InventoryManager::getProductQuantity(int index) const
@@ -503,7 +1856,7 @@ inline int InventoryManager::getProductQuantity(int index) const
         throw out_of_range("Index is invalid!");
     }
 
-    return this->quantities.get(index);
+    return this->table.quantity(this->table.rowOf(index));
 }
 
 inline void InventoryManager::updateQuantity(int index, int newQuantity)
@@ -513,19 +1866,13 @@ inline void InventoryManager::updateQuantity(int index, int newQuantity)
         throw out_of_range("Index is invalid!");
     }
 
-    this->quantities.set(index, newQuantity);
+    this->table.setQuantity(this->table.rowOf(index), newQuantity);
 }
 
 inline void InventoryManager::addProduct(const List1D<InventoryAttribute> &attributes, const string &name, int quantity)
 {
     // TODO
-
-    // Add the product attributes
-    this->attributesMatrix.setRow(this->size(), attributes);
-    // Add the product name
-    this->productNames.add(name);
-    // Add the product quantity
-    this->quantities.add(quantity);
+    this->table.addRow(attributes, name, quantity);
 }
 
 inline void InventoryManager::removeProduct(int index)
@@ -535,114 +1882,183 @@ inline void InventoryManager::removeProduct(int index)
         throw out_of_range("Index is invalid!");
     }
 
-    // rebuild the matrix without the row at index
-    List2D<InventoryAttribute> newMatrix;
+    // a tombstone, O(log n); compacted once enough products are removed (see
+    // compactIfSparse): amortized O(log n + columns) per removal
+    this->table.removeRow(this->table.rowOf(index));
+    this->table.compactIfSparse();
+}
 
-    for (int i = 0; i < this->size(); i++) {
-        // skip the row at index
-        if (i == index) {
-            continue;
+inline void InventoryManager::removeProducts(const List1D<int> &indices)
+{
+    // the rows first: removing a product shifts the indices after it
+    XArrayList<int> rows(nullptr, nullptr, indices.size());
+    for (int k = 0; k < indices.size(); k++) {
+        int index = indices.get(k);
+        if (index < 0 || index >= this->size()) {
+            throw out_of_range("Index is invalid!");
         }
-
-        // Add current row to the new matrix
-        List1D<InventoryAttribute> row = this->attributesMatrix.getRow(i);
-        int newRow = (i < index) ? i : i - 1;
-        newMatrix.setRow(newRow, row);
+        rows.add(this->table.rowOf(index));
     }
-
-    // Create new lists for names and quantities
-    List1D<string> newNames;
-    List1D<int> newQuantities;
-
-    for (int i = 0; i < this->size(); i++) {
-        if (i != index) {
-            newNames.add(this->productNames.get(i));
-            newQuantities.add(this->quantities.get(i));
+    for (int k = 0; k < rows.size(); k++) {
+        if (this->table.isLive(rows.get(k))) {
+            this->table.removeRow(rows.get(k));
         }
     }
+    this->table.compact();
+}
+
+inline void InventoryManager::compact()
+{
+    this->table.compact();
+}
 
-    // Update the current object
-    this->attributesMatrix = newMatrix;
-    this->productNames = newNames;
-    this->quantities = newQuantities;
+/*
+ * rangeMask(values, base, end, minValue, maxValue): bit (r - base) is set when
+ *  minValue <= values[r] <= maxValue, for r in [base, end) (at most 64 products).
+ *  NaN (no attribute) is never in range. No branch: the loop vectorizes.
+ */
+inline unsigned long long inventoryRangeMask(const double *values, int base, int end,
+                                             double minValue, double maxValue)
+{
+    unsigned long long mask = 0;
+    for (int r = base; r < end; r++) {
+        unsigned long long inRange = (values[r] >= minValue) & (values[r] <= maxValue);
+        mask |= inRange << (r - base);
+    }
+    return mask;
 }
 
 inline List1D<string> InventoryManager::query(string attributeName, const double &minValue,
                                        const double &maxValue, int minQuantity, bool ascending) const
 {
     // TODO
-    // Use InventoryAttribute instead of pair<string, double>
-    List1D<InventoryAttribute> matchingProducts;
-    List1D<int> matchingQuantities;
-
-    for (int i = 0; i < this->size(); i++) {
-        // Skip products with quantity less than minQuantity
-        if (this->getProductQuantity(i) < minQuantity) {
-            continue;
-        }
+    return query(attributeName, minValue, maxValue, minQuantity, ascending, this->size());
+}
 
-        List1D<InventoryAttribute> attributes = this->getProductAttributes(i);
-        // Search for the specified attribute
-        for (int j = 0; j < attributes.size(); j++) {
-            InventoryAttribute attr = attributes.get(j);
+inline List1D<string> InventoryManager::query(string attributeName, const double &minValue,
+                                       const double &maxValue, int minQuantity, bool ascending,
+                                       int limit) const
+{
+    // the columns of attributeName: its first, second, ... occurrence in a product
+    XArrayList<const InventoryColumns::Column *> columns;
+    for (int id = this->table.findColumn(attributeName, 0); id != -1;
+         id = this->table.findColumn(attributeName, columns.size())) {
+        columns.add(&this->table.column(id));
+    }
 
-            if (attr.name == attributeName &&
-                attr.value >= minValue &&
-                attr.value <= maxValue) {
-                    // Create a new InventoryAttribute to store the product name and attribute value
-                    InventoryAttribute match(this->getProductName(i), attr.value);
-                    matchingProducts.add(match);
-                    matchingQuantities.add(this->getProductQuantity(i));
-                    break;
+    // Indexed attribute: the index is already in the order of the result
+    if (columns.size() == 1 && columns.get(0)->index != nullptr) {
+        List1D<string> result;
+        if (!(minValue <= maxValue)) {
+            return result;
+        }
+        const InventoryColumns::IndexEntry *index = columns.get(0)->index;
+        int from, to;
+        this->table.indexRange(this->table.findColumn(attributeName, 0), minValue, maxValue, from, to);
+        for (int i = from; i < to && result.size() < limit; i++) {
+            const InventoryColumns::IndexEntry &entry = ascending ? index[i] : index[from + to - 1 - i];
+            if (entry.quantity >= minQuantity && this->table.isLive(entry.row)) {
+                result.add(this->table.name(entry.row));
             }
         }
+        return result;
     }
 
-    // Bubble sort 
-    for (int i = 0; i < matchingProducts.size() - 1; i++) {
-        for (int j = 0; j < matchingProducts.size() - i - 1; j++) {
-            bool shouldSwap = false;
-            //  First, sorted by value
-            if (matchingProducts.get(j).value != matchingProducts.get(j + 1).value) {
-                // Based on ascending flag
-                shouldSwap = ascending ?
-                matchingProducts.get(j).value > matchingProducts.get(j + 1).value :
-                matchingProducts.get(j).value < matchingProducts.get(j + 1).value;
-            } else if (matchingQuantities.get(j) != matchingQuantities.get(j + 1)) {
-                // If value are equal, sort by quantity
-                shouldSwap = ascending ?
-                matchingQuantities.get(j) > matchingQuantities.get(j + 1) :
-                matchingQuantities.get(j) < matchingQuantities.get(j + 1);
-            } else {
-                // if ascending is true, maintain original order
-                // and reverse original order when descending
-                shouldSwap = !ascending;
+    // Scan 64 products at a time: a product matches with the first occurrence of the
+    // attribute that is in range, as when reading its attributes in order
+    const int *quantities = this->table.quantityData();
+    const unsigned long long *live = this->table.liveData();
+    int rows = this->table.rowCount();
+    XArrayList<InventoryColumns::IndexEntry> matches;
+    XArrayList<unsigned long long> masks(nullptr, nullptr, columns.size());
+    for (int k = 0; k < columns.size(); k++) {
+        masks.add(0);
+    }
+    for (int base = 0; base < rows && columns.size() > 0; base += 64) {
+        int end = (base + 64 < rows) ? base + 64 : rows;
+        unsigned long long pending = 0;
+        for (int r = base; r < end; r++) {
+            unsigned long long enough = (quantities[r] >= minQuantity);
+            pending |= enough << (r - base);
+        }
+        pending &= live[base >> 6];
+        unsigned long long matched = 0;
+        for (int k = 0; k < columns.size() && pending != matched; k++) {
+            masks.get(k) = inventoryRangeMask(columns.get(k)->values, base, end, minValue, maxValue)
+                           & pending & ~matched;
+            matched |= masks.get(k);
+        }
+        for (; matched != 0; matched &= matched - 1) {
+            int bit = __builtin_ctzll(matched);
+            int k = 0;
+            while (!((masks.get(k) >> bit) & 1ULL)) {
+                k++;
             }
-            
-
-            if (shouldSwap) {
-                // Swap products
-                InventoryAttribute temp = matchingProducts.get(j);
-                matchingProducts.set(j, matchingProducts.get(j + 1));
-                matchingProducts.set(j + 1, temp);
-
-                // Swap quantities
-                int tempQuantity = matchingQuantities.get(j);
-                matchingQuantities.set(j, matchingQuantities.get(j + 1));
-                matchingQuantities.set(j + 1, tempQuantity);
-            }    
+            InventoryColumns::IndexEntry entry = {columns.get(k)->values[base + bit], quantities[base + bit], base + bit};
+            matches.add(entry);
         }
     }
 
-    // Extract the product names
+    // Order the matches by (value, quantity, row): the same as a stable sort by value,
+    // then quantity; the descending result is the reverse of the ascending one
     List1D<string> result;
-    for (int i = 0; i < matchingProducts.size(); i++) {
-        result.add(matchingProducts.get(i).name);
+    if (limit < matches.size()) {
+        // top-k: a heap of the best "limit" matches so far, the worst of them on top,
+        // O(m log k) instead of sorting all m matches
+        Heap<InventoryColumns::IndexEntry> best(ascending ? &worstFirstAscending : &worstFirstDescending);
+        for (int i = 0; i < matches.size() && limit > 0; i++) {
+            InventoryColumns::IndexEntry &entry = matches.get(i);
+            if (best.size() < limit) {
+                best.push(entry);
+            }
+            else if (ascending ? InventoryColumns::indexLess(entry, best.peek())
+                               : InventoryColumns::indexLess(best.peek(), entry)) {
+                best.pop();
+                best.push(entry);
+            }
+        }
+        matches.clear();
+        while (!best.empty()) {
+            matches.add(best.pop());
+        }
+        for (int i = matches.size() - 1; i >= 0; i--) {
+            result.add(this->table.name(matches.get(i).row));
+        }
+        return result;
     }
 
+    matches.stableSort([](InventoryColumns::IndexEntry &lhs, InventoryColumns::IndexEntry &rhs) {
+        if (lhs.value != rhs.value) {
+            return (lhs.value < rhs.value) ? -1 : 1;
+        }
+        return (lhs.quantity < rhs.quantity) ? -1 : (lhs.quantity > rhs.quantity) ? 1 : 0;
+    });
+    for (int i = 0; i < matches.size(); i++) {
+        int position = ascending ? i : matches.size() - 1 - i;
+        result.add(this->table.name(matches.get(position).row));
+    }
     return result;
 }
 
+inline void InventoryManager::createIndex(const string &attributeName)
+{
+    this->table.createIndex(attributeName);
+}
+
+inline void InventoryManager::dropIndex(const string &attributeName)
+{
+    int id = this->table.findColumn(attributeName, 0);
+    if (id != -1) {
+        this->table.dropIndex(id);
+    }
+}
+
+inline bool InventoryManager::hasIndex(const string &attributeName) const
+{
+    int id = this->table.findColumn(attributeName, 0);
+    return id != -1 && this->table.column(id).index != nullptr;
+}
+
 inline void InventoryManager::removeDuplicates()
 {
     // TODO
@@ -650,63 +2066,38 @@ inline void InventoryManager::removeDuplicates()
         return;
     }
 
-    // Track which products should be removed
-    List1D<bool> shouldRemove;
-    for (int i = 0; i < this->size(); i++) {
-        shouldRemove.add(false);
-    }
-
-    // Check each pair of products
-    // O(n2)
-    for (int i = 0; i < this->size() - 1; i++) {
-        // Skip if product is already marked
-        if (shouldRemove.get(i)) {
+    // One pass: the first product of each group of duplicates is found by hashing,
+    // and takes the quantities of the later ones
+    xMap<DuplicateKey, int> firstRows(&InventoryManager::duplicateKeyHash, 0.75f, nullptr, nullptr,
+                                      &InventoryManager::duplicateKeyEqual);
+    // (the rows removed before are dropped in the same sweep)
+    int rows = this->table.rowCount();
+    XArrayList<unsigned int> sums(nullptr, nullptr, rows); // unsigned: sums wrap, never overflow
+    XArrayList<int> removed;
+    firstRows.reserve(this->size());
+    for (int r = 0; r < rows; r++) {
+        sums.add((unsigned int)this->table.quantity(r));
+        if (!this->table.isLive(r)) {
+            removed.add(r);
             continue;
         }
-
-        string nameI = this->getProductName(i);
-        List1D<InventoryAttribute> attributesI = this->getProductAttributes(i);
-        int quantitySum = this->getProductQuantity(i);
-
-        for (int j = i + 1; j < this->size(); j++) {
-            // Skip if product is already marked
-            if (shouldRemove.get(j)) {
-                continue;
-            }
-            // Check if the names match
-            if (this->getProductName(j) != nameI) {
-                continue;
-            }
-
-            // Check if the attributes match
-            List1D<InventoryAttribute> attributesJ = this->getProductAttributes(j);
-            if (attributesI.size() != attributesJ.size()) {
-                continue;
-            }
-            bool match = true;
-            for (int k = 0; k < attributesI.size(); k++) {
-                // operator == defined in InventoryAttribute
-                if (!(attributesI.get(k) == attributesJ.get(k))) {
-                    match = false;
-                    break;
-                }
-            }
-
-            // If all attributes and name match, it's duplicate
-            if (match) {
-                quantitySum += this->getProductQuantity(j);
-                shouldRemove.set(j, true);
-            }
+        DuplicateKey key = {&this->table, r, this->table.rowHash(r)};
+        int first = firstRows.putIfAbsent(key, r);
+        if (first != r) {
+            sums.get(first) += sums.get(r);
+            removed.add(r);
         }
-        this->updateQuantity(i, quantitySum);
+    }
+    if (removed.size() == 0) {
+        return;
     }
 
-    // Removed all marked, starting from the end to avoid index shift
-    for (int i = this->size() - 1; i >= 0; i--) {
-        if (shouldRemove.get(i)) {
-            this->removeProduct(i);
+    for (int r = 0; r < rows; r++) {
+        if (this->table.isLive(r) && (int)sums.get(r) != this->table.quantity(r)) {
+            this->table.setQuantity(r, (int)sums.get(r));
         }
     }
+    this->table.removeRows(removed);
 }
 
 inline InventoryManager InventoryManager::merge(const InventoryManager &inv1,
@@ -797,25 +2188,42 @@ inline void InventoryManager::split(InventoryManager &section1,
 inline List2D<InventoryAttribute> InventoryManager::getAttributesMatrix() const
 {
     // TODO
-    return this->attributesMatrix;
+    List2D<InventoryAttribute> matrix;
+    int i = 0;
+    for (int r = this->table.nextRow(-1); r < this->table.rowCount(); r = this->table.nextRow(r)) {
+        matrix.setRow(i++, this->table.getRow(r));
+    }
+    return matrix;
 }
 
 inline List1D<string> InventoryManager::getProductNames() const
 {
     // TODO
-    return this->productNames;
+    List1D<string> names;
+    for (int r = this->table.nextRow(-1); r < this->table.rowCount(); r = this->table.nextRow(r)) {
+        names.add(this->table.name(r));
+    }
+    return names;
 }
 
 inline List1D<int> InventoryManager::getQuantities() const
 {
     // TODO
-    return this->quantities;
+    if (this->table.size() == this->table.rowCount()) {
+        return List1D<int>(this->table.quantityData(), this->size());
+    }
+    List1D<int> quantities(this->size());
+    for (int r = this->table.nextRow(-1); r < this->table.rowCount(); r = this->table.nextRow(r)) {
+        quantities.add(this->table.quantity(r));
+    }
+    return quantities;
 }
 
 inline string InventoryManager::toString() const
 {
     // TODO
     stringstream ss;
+    int first = this->table.nextRow(-1); // row of the first product
     
     // Product Names line
     // ss << "------------------------\n"; // just add this bcs of tc in lms
@@ -837,21 +2245,20 @@ inline string InventoryManager::toString() const
     //  I will implement it my self with the fixed precision
     ss << "  AttributesMatrix: [";
      // Special case for empty matrix
-     if (this->attributesMatrix.rows() == 0) {
+     if (this->size() == 0) {
         ss << "],\n";
     } else {
         ss << "[";
-        for (int i = 0; i < this->attributesMatrix.rows(); i++) {
-            if (i > 0) {
+        for (int r = this->table.nextRow(-1); r < this->table.rowCount(); r = this->table.nextRow(r)) {
+            if (r != first) {
                 ss << "], [";
             }
-            List1D<InventoryAttribute> row = this->attributesMatrix.getRow(i);
-            for (int j = 0; j < row.size(); j++) {
+            AttributeRowView attributes(&this->table, r);
+            for (int j = 0; j < attributes.size(); j++) {
                 if (j > 0) {
                     ss << ", ";
                 }
-                InventoryAttribute attr = row.get(j);
-                ss << attr.name << ": " << fixed << setprecision(6) << attr.value;
+                ss << attributes.name(j) << ": " << fixed << setprecision(6) << attributes.value(j);
             }
         }
         ss << "]],\n";
@@ -860,24 +2267,24 @@ inline string InventoryManager::toString() const
 
     // Add product names
     ss << "  ProductNames: [";
-    for (int i = 0; i < this->productNames.size(); i++) {
-        if (i > 0) {
+    for (int r = this->table.nextRow(-1); r < this->table.rowCount(); r = this->table.nextRow(r)) {
+        if (r != first) {
             ss << ", ";
         }
         // in docs there is " around the names" of product but in testcase is not
         // so will change this if needed --- 21/03/2025
         // ss << "\"" << this->productNames.get(i) << "\"";
-        ss << this->productNames.get(i);
+        ss << this->table.name(r);
     }
     ss << "],\n";
     
     // Add quantities
     ss << "  Quantities: [";
-    for (int i = 0; i < this->quantities.size(); i++) {
-        if (i > 0) {
+    for (int r = this->table.nextRow(-1); r < this->table.rowCount(); r = this->table.nextRow(r)) {
+        if (r != first) {
             ss << ", ";
         }
-        ss << this->quantities.get(i);
+        ss << this->table.quantity(r);
     }
     ss << "]\n";
     
@@ -7,10 +7,13 @@
 #include <iomanip>
 #include <stdexcept>
 #include <utility>
+#include <climits>
+#include <cstdio>
 #include "inventory.h"
 #include "hash/xMap.h"
 #include "heap/Heap.h"
 #include "list/XArrayList.h"
+#include "list/SmallXArrayList.h"
 
 
 // should remove this when I submit the final (this just for testing on my local machine)
@@ -31,16 +34,23 @@ template<int treeOrder>
 class HuffmanTree {
 public:
     struct HuffmanNode {
+        // a node has at most treeOrder children: keep them inside the node (no malloc)
+        typedef SmallXArrayList<HuffmanNode*, treeOrder> ChildList;
+
         char symbol;
         int freq;
         int insertOrder;  // Add insertion order to track priority
-        XArrayList<HuffmanNode*> children;
+        ChildList children;
 
         // HuffmanNode(char s, int f); //Leaf node
         // HuffmanNode(int f, const  XArrayList<HuffmanNode*>& childs); //Internal node
 
         HuffmanNode(char s, int f, int order = -1) : symbol(s), freq(f), insertOrder(order), children() {} //Leaf node
-        HuffmanNode(int f, const XArrayList<HuffmanNode*>& childs) : symbol('\0'), freq(f), insertOrder(-1), children(childs) {} // Internal node
+        HuffmanNode(int f, const ChildList& childs) : symbol('\0'), freq(f), insertOrder(-1), children(childs) {} // Internal node
+        HuffmanNode(int f, const XArrayList<HuffmanNode*>& childs) : symbol('\0'), freq(f), insertOrder(-1), children() {
+            XArrayList<HuffmanNode*>& source = const_cast<XArrayList<HuffmanNode*>&>(childs);
+            for (int i = 0; i < source.size(); i++) children.add(source.get(i));
+        }
     };
 
     HuffmanTree();
@@ -75,6 +85,9 @@ private:
     InventoryManager* invManager;
     HuffmanTree<treeOrder>* tree;
 
+    // countSymbols: freq[c] += occurrences of c in productToString(attributes, name)
+    static void countSymbols(const AttributeRowView& attributes, const std::string& name, int* freq);
+
     
 };
 
@@ -107,7 +120,7 @@ void HuffmanTree<treeOrder>::build(XArrayList<pair<char, int>>& symbolsFreqs)
          
 
         // For n-ary tree (n > 2) with a single character
-        XArrayList<HuffmanNode*> children;
+        typename HuffmanNode::ChildList children;
         
         // No need to add dummy nodes if the frequency is 0
         if (freq == 0) {
@@ -170,7 +183,7 @@ void HuffmanTree<treeOrder>::build(XArrayList<pair<char, int>>& symbolsFreqs)
     
     while (minHeap.size() > 1) {
         int nodesToMerge = min(treeOrder, minHeap.size());
-        XArrayList<HuffmanNode*> children;
+        typename HuffmanNode::ChildList children;
         int totalFreq = 0;
         
         for (int i = 0; i < nodesToMerge; i++) {
@@ -317,56 +330,21 @@ void InventoryCompressor<treeOrder>::buildHuffman()
 {
     //TODO
 
-    // Create frequency map
-    xMap<char, int> freqMap(
-        [](char& c, int capacity) -> int { 
-            return static_cast<int>(c) % capacity; 
-        }
-    );
-
-    // Count frequencies for all products
+    // Count frequencies for all products, reading them in place (no copy of the
+    // attributes, no string per product)
+    int freq[256] = {0};
     for (int i = 0; i < invManager->size(); i++) {
-        std::string productStr = productToString(
-            invManager->getProductAttributes(i),
-            invManager->getProductName(i)
-        );
-        
-        for (char c : productStr) {
-            if (freqMap.containsKey(c)) {
-                freqMap.put(c, freqMap.get(c) + 1);
-            } else {
-                freqMap.put(c, 1);
-            }
-        }
-    }
-    
-    // Convert to list of pairs for Huffman tree
-    XArrayList<std::pair<char, int>> symbolFreqs;
-    DLinkedList<char> keys = freqMap.keys();
-   // Create a sorted array of characters
-    XArrayList<char> sortedChars;
-    for (char c : keys) {
-        sortedChars.add(c);
+        countSymbols(invManager->getProductAttributesView(i), invManager->getProductNameView(i), freq);
     }
 
-    // Sort characters by ASCII value
-    for (int i = 0; i < sortedChars.size() - 1; i++) {
-        for (int j = 0; j < sortedChars.size() - i - 1; j++) {
-            if (sortedChars.get(j) > sortedChars.get(j + 1)) {
-                char temp = sortedChars.get(j);
-                sortedChars.removeAt(j);
-                sortedChars.add(j, sortedChars.get(j));
-                sortedChars.removeAt(j + 1);
-                sortedChars.add(j + 1, temp);
-            }
+    // Pairs for Huffman tree, in ASCII order (as sorted chars: signed or not)
+    XArrayList<std::pair<char, int>> symbolFreqs;
+    for (int c = CHAR_MIN; c <= CHAR_MAX; c++) {
+        int count = freq[(unsigned char)c];
+        if (count > 0) {
+            symbolFreqs.add(std::make_pair((char)c, count));
         }
     }
-
-    // Add pairs to symbolFreqs in ASCII order
-    for (int i = 0; i < sortedChars.size(); i++) {
-        char c = sortedChars.get(i);
-        symbolFreqs.add(std::make_pair(c, freqMap.get(c)));
-    }
     
     // Build Huffman tree and generate codes
     tree->build(symbolFreqs);
@@ -400,6 +378,33 @@ std::string InventoryCompressor<treeOrder>::productToString(const List1D<Invento
     return ss.str();
 }
 
+template <int treeOrder>
+void InventoryCompressor<treeOrder>::countSymbols(const AttributeRowView &attributes, const std::string &name, int *freq)
+{
+    // the same characters as productToString: "name:(attr: value), (attr: value)"
+    for (char c : name)
+        freq[(unsigned char)c]++;
+    freq[(unsigned char)':']++;
+
+    char number[512]; // "%.6f" of any double (at most 309 digits before the point)
+    for (int i = 0; i < attributes.size(); i++) {
+        if (i > 0) {
+            freq[(unsigned char)',']++;
+            freq[(unsigned char)' ']++;
+        }
+        freq[(unsigned char)'(']++;
+        for (char c : attributes.name(i))
+            freq[(unsigned char)c]++;
+        freq[(unsigned char)':']++;
+        freq[(unsigned char)' ']++;
+        // std::fixed << std::setprecision(6) formats as "%.6f"
+        int length = snprintf(number, sizeof(number), "%.6f", attributes.value(i));
+        for (int k = 0; k < length; k++)
+            freq[(unsigned char)number[k]]++;
+        freq[(unsigned char)')']++;
+    }
+}
+
 template <int treeOrder>
 std::string InventoryCompressor<treeOrder>::encodeHuffman(const List1D<InventoryAttribute> &attributes, const std::string &name)
 {
@@ -0,0 +1,162 @@
+#ifndef STRINGDICTIONARY_H
+#define STRINGDICTIONARY_H
+#include <string>
+#include <stdexcept>
+using namespace std;
+
+#include "hash/xMap.h"
+#include "list/XArrayList.h"
+
+/*
+ * StringDictionary: gives every distinct string a small integer id (0, 1, 2, ...
+ * in order of first appearance), so the string can be stored and compared as an int.
+ *  For example:
+ *      StringDictionary names;
+ *      int weight = names.intern("weight");    // 0
+ *      names.intern("height");                 // 1
+ *      names.intern("weight");                 // 0 again
+ *      names.find("depth");                    // -1: never interned
+ *      names.get(weight);                      // "weight"
+ *  Each string is stored once, whatever the number of times it is interned.
+ */
+class StringDictionary
+{
+private:
+    // created by the first intern: an empty dictionary owns no memory, so it is
+    // built and moved without allocating (noexcept)
+    xMap<string, int> *ids;      // string -> id
+    XArrayList<string> *strings; // id -> string
+
+public:
+    StringDictionary() noexcept : ids(nullptr), strings(nullptr) {}
+    StringDictionary(const StringDictionary &other) : ids(nullptr), strings(nullptr)
+    {
+        copyFrom(other);
+    }
+    StringDictionary(StringDictionary &&other) noexcept : ids(other.ids), strings(other.strings)
+    {
+        other.ids = nullptr;
+        other.strings = nullptr;
+    }
+    StringDictionary &operator=(const StringDictionary &other)
+    {
+        if (this != &other)
+        {
+            clear();
+            copyFrom(other);
+        }
+        return *this;
+    }
+    StringDictionary &operator=(StringDictionary &&other) noexcept
+    {
+        if (this != &other)
+        {
+            clear();
+            this->ids = other.ids;
+            this->strings = other.strings;
+            other.ids = nullptr;
+            other.strings = nullptr;
+        }
+        return *this;
+    }
+    ~StringDictionary()
+    {
+        clear();
+    }
+
+    /* intern(str): id of str; str is added when it is new
+     */
+    int intern(const string &str)
+    {
+        // a known string (the common case) costs one lookup, and no copy
+        int id = find(str);
+        if (id != -1)
+            return id;
+        if (this->ids == nullptr)
+        {
+            this->ids = new xMap<string, int>(&StringDictionary::hash);
+            try
+            {
+                this->strings = new XArrayList<string>();
+            }
+            catch (...)
+            {
+                delete this->ids;
+                this->ids = nullptr;
+                throw;
+            }
+        }
+        id = this->strings->size();
+        this->strings->add(str);
+        try
+        {
+            this->ids->put(str, id);
+        }
+        catch (...)
+        {
+            this->strings->removeAt(id);
+            throw;
+        }
+        return id;
+    }
+    /* find(str): id of str, -1 when str was never interned
+     */
+    int find(const string &str) const
+    {
+        if (this->ids == nullptr)
+            return -1;
+        // one lookup, no copy: xMap's hash and equality take non-const keys, but do not modify them
+        const int *pId = this->ids->find(const_cast<string &>(str));
+        return (pId != nullptr) ? *pId : -1;
+    }
+    const string &get(int id) const
+    {
+        if (id < 0 || id >= size())
+            throw out_of_range("Index is out of range!");
+        return this->strings->get(id);
+    }
+    int size() const
+    {
+        return (this->strings != nullptr) ? this->strings->size() : 0;
+    }
+    void clear()
+    {
+        delete this->ids;
+        delete this->strings;
+        this->ids = nullptr;
+        this->strings = nullptr;
+    }
+
+    /* hash: FNV-1a (xMap::stringKeyHash sums the characters: "ab" and "ba" collide)
+     */
+    static int hash(string &key, int capacity)
+    {
+        unsigned int code = 2166136261u;
+        for (unsigned char ch : key)
+        {
+            code ^= ch;
+            code *= 16777619u;
+        }
+        return (int)(code % (unsigned int)capacity);
+    }
+
+private:
+    void copyFrom(const StringDictionary &other)
+    {
+        if (other.ids == nullptr)
+            return;
+        this->ids = new xMap<string, int>(*other.ids);
+        try
+        {
+            this->strings = new XArrayList<string>(*other.strings);
+        }
+        catch (...)
+        {
+            delete this->ids;
+            this->ids = nullptr;
+            throw;
+        }
+    }
+};
+
+#endif /* STRINGDICTIONARY_H */
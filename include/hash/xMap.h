@@ -9,43 +9,52 @@ using namespace std;
 
 #include "list/DLinkedList.h"
 #include "hash/IMap.h"
+#include "util/MemLib.h"
 
 /*
  * xMap<K, V>:
  *  + K: key type
  *  + V: value type
+ *  + Alloc: where entries, bucket nodes and the table come from (see util/Allocator.h)
  *  For example:
  *      xMap<string, int>: map from string to int
  */
-template <class K, class V>
+template <class K, class V, class Alloc = MallocAllocator>
 class xMap : public IMap<K, V>
 {
 public:
     class Entry; // forward declaration
 
 protected:
-    DLinkedList<Entry *> *table; // array of DLinkedList objects
-    int capacity;                // size of table
-    int count;                   // number of entries stored hash-map
-    float loadFactor;            // define max number of entries can be stored (< (loadFactor * capacity))
+    struct FreeEntry
+    {
+        FreeEntry *next;
+    };
 
-    int (*hashCode)(K &, int);          // hasCode(K key, int tableSize): tableSize means capacity
-    bool (*keyEqual)(K &, K &);         // keyEqual(K& lhs, K& rhs): test if lhs == rhs
-    bool (*valueEqual)(V &, V &);       // valueEqual(V& lhs, V& rhs): test if lhs == rhs
-    void (*deleteKeys)(xMap<K, V> *);   // deleteKeys(xMap<K,V>* pMap): delete all keys stored in pMap
-    void (*deleteValues)(xMap<K, V> *); // deleteValues(xMap<K,V>* pMap): delete all values stored in pMap
+    DLinkedList<Entry *, Alloc> *table; // array of DLinkedList objects
+    int capacity;                       // size of table
+    int count;                          // number of entries stored hash-map
+    float loadFactor;                   // define max number of entries can be stored (< (loadFactor * capacity))
+    FreeEntry *freeEntries;             // memory of removed entries, reused by put (see newEntry)
+    int numFreeEntries;                 // entries in freeEntries (at most MAX_FREE_ENTRIES)
+
+    int (*hashCode)(K &, int);                 // hasCode(K key, int tableSize): tableSize means capacity
+    bool (*keyEqual)(K &, K &);                // keyEqual(K& lhs, K& rhs): test if lhs == rhs
+    bool (*valueEqual)(V &, V &);              // valueEqual(V& lhs, V& rhs): test if lhs == rhs
+    void (*deleteKeys)(xMap<K, V, Alloc> *);   // deleteKeys(xMap<K,V>* pMap): delete all keys stored in pMap
+    void (*deleteValues)(xMap<K, V, Alloc> *); // deleteValues(xMap<K,V>* pMap): delete all values stored in pMap
 
 public:
     xMap(
         int (*hashCode)(K &, int), // require
         float loadFactor = 0.75f,
         bool (*valueEqual)(V &, V &) = 0,
-        void (*deleteValues)(xMap<K, V> *) = 0,
+        void (*deleteValues)(xMap<K, V, Alloc> *) = 0,
         bool (*keyEqual)(K &, K &) = 0,
-        void (*deleteKeys)(xMap<K, V> *) = 0);
+        void (*deleteKeys)(xMap<K, V, Alloc> *) = 0);
 
-    xMap(const xMap<K, V> &map);                  // copy constructor
-    xMap<K, V> &operator=(const xMap<K, V> &map); // assignment operator
+    xMap(const xMap<K, V, Alloc> &map);                  // copy constructor
+    xMap<K, V, Alloc> &operator=(const xMap<K, V, Alloc> &map); // assignment operator
     ~xMap();
 
     // Inherit from IMap:BEGIN
@@ -64,6 +73,19 @@ public:
     DLinkedList<int> clashes();
     // Inherit from IMap:END
 
+    /* putIfAbsent(key, value): the value of key when key is in the map (the map is
+     *  not changed), else puts (key, value) and returns value; one lookup only
+     */
+    V putIfAbsent(K key, V value);
+    /* find(key): address of the value of key, nullptr when key is not in the map;
+     *  one lookup, no copy of key (valid until the map is modified)
+     */
+    V *find(K &key);
+    /* reserve(expectedSize): grows the table once, so that the next puts up to
+     *  expectedSize entries do not rehash
+     */
+    void reserve(int expectedSize);
+
     // Show map on screen: need to convert key to string (key2str) and value2str
     void println(string (*key2str)(K &) = 0, string (*value2str)(V &) = 0)
     {
@@ -102,11 +124,11 @@ public:
      *      1. K is a pointer type; AND
      *      2. Users need xMap to free keys
      */
-    static void freeKey(xMap<K, V> *pMap)
+    static void freeKey(xMap<K, V, Alloc> *pMap)
     {
         for (int idx = 0; idx < pMap->capacity; idx++)
         {
-            DLinkedList<Entry *> list = pMap->table[idx];
+            DLinkedList<Entry *, Alloc> list = pMap->table[idx];
             for (auto pEntry : list)
             {
                 delete pEntry->key;
@@ -120,11 +142,11 @@ public:
      *      1. V is a pointer type; AND
      *      2. Users need xMap to free values
      */
-    static void freeValue(xMap<K, V> *pMap)
+    static void freeValue(xMap<K, V, Alloc> *pMap)
     {
         for (int idx = 0; idx < pMap->capacity; idx++)
         {
-            DLinkedList<Entry *> list = pMap->table[idx];
+            DLinkedList<Entry *, Alloc> list = pMap->table[idx];
             for (auto pEntry : list)
             {
                 delete pEntry->value;
@@ -136,7 +158,8 @@ public:
      */
     static void deleteEntry(Entry *ptr)
     {
-        delete ptr;
+        ptr->~Entry();
+        Alloc::deallocate(ptr, entryBytes());
     }
     ///////////////////////////////////////////////////
     // STATIC METHODS: END
@@ -152,10 +175,68 @@ protected:
     //   should add a method to trim table shorter when removing key (and value)
     void rehash(int newCapacity);
     void removeInternalData();
-    void copyMapFrom(const xMap<K, V> &map);
+    void copyMapFrom(const xMap<K, V, Alloc> &map);
     void moveEntries(
-        DLinkedList<Entry *> *oldTable, int oldCapacity,
-        DLinkedList<Entry *> *newTable, int newCapacity);
+        DLinkedList<Entry *, Alloc> *oldTable, int oldCapacity,
+        DLinkedList<Entry *, Alloc> *newTable, int newCapacity);
+    /*
+     * newEntry, createTable, destroyTable: entries and the table (array of buckets) come from Alloc
+     *  + removed entries are kept in "freeEntries" (see recycleEntry) and reused by put,
+     *      up to MAX_FREE_ENTRIES entries; beyond that, the memory goes back to Alloc
+     *  + the buckets keep no free node: remove gives the node back to Alloc at once
+     *      (each bucket would keep up to DLinkedList::MAX_FREE_NODES of its own,
+     *      so the whole table would keep about one node per entry ever removed)
+     */
+    static const int MAX_FREE_ENTRIES = 64;
+
+    static size_t entryBytes()
+    {
+        return (sizeof(Entry) > sizeof(FreeEntry)) ? sizeof(Entry) : sizeof(FreeEntry);
+    }
+    Entry *newEntry(K &key, V &value)
+    {
+        if (this->freeEntries == nullptr)
+            return new (Alloc::allocate(entryBytes())) Entry(key, value);
+        FreeEntry *pFree = this->freeEntries;
+        this->freeEntries = pFree->next;
+        this->numFreeEntries--;
+        return new (pFree) Entry(key, value);
+    }
+    void recycleEntry(Entry *pEntry)
+    {
+        pEntry->~Entry();
+        if (this->numFreeEntries == MAX_FREE_ENTRIES)
+        {
+            Alloc::deallocate(pEntry, entryBytes());
+            return;
+        }
+        FreeEntry *pFree = new (pEntry) FreeEntry;
+        pFree->next = this->freeEntries;
+        this->freeEntries = pFree;
+        this->numFreeEntries++;
+    }
+    void releaseFreeEntries()
+    {
+        while (this->freeEntries != nullptr)
+        {
+            FreeEntry *next = this->freeEntries->next;
+            Alloc::deallocate(this->freeEntries, entryBytes());
+            this->freeEntries = next;
+        }
+        this->numFreeEntries = 0;
+    }
+    static DLinkedList<Entry *, Alloc> *createTable(int capacity)
+    {
+        DLinkedList<Entry *, Alloc> *table = allocRaw<DLinkedList<Entry *, Alloc>, Alloc>(capacity);
+        for (int i = 0; i < capacity; i++)
+            new (&table[i]) DLinkedList<Entry *, Alloc>();
+        return table;
+    }
+    static void destroyTable(DLinkedList<Entry *, Alloc> *table, int capacity)
+    {
+        destroyRange(table, 0, capacity);
+        freeRaw<DLinkedList<Entry *, Alloc>, Alloc>(table, capacity);
+    }
 
     /*
      * keyEQ(K& lhs, K& rhs): verify the equality of two keys
@@ -188,7 +269,7 @@ public:
     private:
         K key;
         V value;
-        friend class xMap<K, V>;
+        friend class xMap<K, V, Alloc>;
 
     public:
         Entry(K key, V value)
@@ -204,14 +285,14 @@ public:
 ////////////////////////     METHOD DEFNITION      ///////////////////
 //////////////////////////////////////////////////////////////////////
 
-template <class K, class V>
-xMap<K, V>::xMap(
+template <class K, class V, class Alloc>
+xMap<K, V, Alloc>::xMap(
     int (*hashCode)(K &, int),
     float loadFactor,
     bool (*valueEqual)(V &lhs, V &rhs),
-    void (*deleteValues)(xMap<K, V> *),
+    void (*deleteValues)(xMap<K, V, Alloc> *),
     bool (*keyEqual)(K &lhs, K &rhs),
-    void (*deleteKeys)(xMap<K, V> *pMap))
+    void (*deleteKeys)(xMap<K, V, Alloc> *pMap))
 {
     // YOUR CODE IS HERE
     this->hashCode = hashCode;
@@ -223,25 +304,25 @@ xMap<K, V>::xMap(
 
     this->count = 0;
     this->capacity = 10;
+    this->freeEntries = nullptr;
+    this->numFreeEntries = 0;
 
-    this->table = new DLinkedList<Entry*>[capacity];
-    // Initialize table:
-    for (int i = 0; i < this->capacity; i++) {
-        this->table[i] = DLinkedList<Entry*>();
-    } 
+    this->table = createTable(this->capacity);
 }
 
-template <class K, class V>
-xMap<K, V>::xMap(const xMap<K, V> &map)
+template <class K, class V, class Alloc>
+xMap<K, V, Alloc>::xMap(const xMap<K, V, Alloc> &map)
 {
     // YOUR CODE IS HERE
     this->deleteKeys = nullptr;  
     this->deleteValues = nullptr;
+    this->freeEntries = nullptr;
+    this->numFreeEntries = 0;
     copyMapFrom(map); 
 }
 
-template <class K, class V>
-xMap<K, V> &xMap<K, V>::operator=(const xMap<K, V> &map)
+template <class K, class V, class Alloc>
+xMap<K, V, Alloc> &xMap<K, V, Alloc>::operator=(const xMap<K, V, Alloc> &map)
 {
     // YOUR CODE IS HERE
     if (this != &map) {
@@ -252,8 +333,8 @@ xMap<K, V> &xMap<K, V>::operator=(const xMap<K, V> &map)
     return *this;
 }
 
-template <class K, class V>
-xMap<K, V>::~xMap()
+template <class K, class V, class Alloc>
+xMap<K, V, Alloc>::~xMap()
 {
     // YOUR CODE IS HERE
     removeInternalData();
@@ -263,8 +344,8 @@ xMap<K, V>::~xMap()
 //////////////////////// IMPLEMENTATION of IMap    ///////////////////
 //////////////////////////////////////////////////////////////////////
 
-template <class K, class V>
-V xMap<K, V>::put(K key, V value)
+template <class K, class V, class Alloc>
+V xMap<K, V, Alloc>::put(K key, V value)
 {
     // Get index of the key
     int index = this->hashCode(key, capacity);
@@ -273,7 +354,7 @@ V xMap<K, V>::put(K key, V value)
     V retValue = value;
 
     // Check if key already exists
-    DLinkedList<Entry*>& list = table[index];
+    DLinkedList<Entry *, Alloc>& list = table[index];
     for(auto pEntry: list){
         if(keyEQ(pEntry->key, key)){
             retValue = pEntry->value;
@@ -284,7 +365,7 @@ V xMap<K, V>::put(K key, V value)
     }
 
     // Put the new key-value pair
-    Entry* pEntry = new Entry(key, value);
+    Entry* pEntry = newEntry(key, value);
     list.add(pEntry);
 
     // Increase count
@@ -295,12 +376,53 @@ V xMap<K, V>::put(K key, V value)
     return retValue;
 }
 
-template <class K, class V>
-V &xMap<K, V>::get(K key)
+template <class K, class V, class Alloc>
+V xMap<K, V, Alloc>::putIfAbsent(K key, V value)
+{
+    int index = this->hashCode(key, capacity);
+    DLinkedList<Entry *, Alloc>& list = table[index];
+    for(auto pEntry: list){
+        if(keyEQ(pEntry->key, key)){
+            return pEntry->value;
+        }
+    }
+
+    Entry* pEntry = newEntry(key, value);
+    list.add(pEntry);
+    count++;
+    ensureLoadFactor(count);
+    return value;
+}
+
+template <class K, class V, class Alloc>
+V *xMap<K, V, Alloc>::find(K &key)
+{
+    int index = this->hashCode(key, capacity);
+    DLinkedList<Entry *, Alloc>& bucket = table[index];
+    for(auto pEntry: bucket){
+        if(keyEQ(pEntry->key, key)){
+            return &pEntry->value;
+        }
+    }
+    return nullptr;
+}
+
+template <class K, class V, class Alloc>
+void xMap<K, V, Alloc>::reserve(int expectedSize)
+{
+    int minCapacity = (int)(expectedSize / loadFactor) + 1;
+    if (minCapacity > capacity)
+    {
+        rehash(minCapacity);
+    }
+}
+
+template <class K, class V, class Alloc>
+V &xMap<K, V, Alloc>::get(K key)
 {
     int index = hashCode(key, capacity);
     // YOUR CODE IS HERE
-    DLinkedList<Entry*>& bucket = table[index];
+    DLinkedList<Entry *, Alloc>& bucket = table[index];
 
     for (auto pEntry : bucket) {
        if (keyEQ(pEntry->key, key)) {
@@ -313,12 +435,12 @@ V &xMap<K, V>::get(K key)
     throw KeyNotFound(os.str());
 }
 
-template <class K, class V>
-V xMap<K, V>::remove(K key, void (*deleteKeyInMap)(K))
+template <class K, class V, class Alloc>
+V xMap<K, V, Alloc>::remove(K key, void (*deleteKeyInMap)(K))
 {
     int index = hashCode(key, capacity);
     // YOUR CODE IS HERE
-    DLinkedList<Entry*>& bucket = table[index];
+    DLinkedList<Entry *, Alloc>& bucket = table[index];
     for (auto pEntry : bucket) {
         if (keyEQ(pEntry->key, key)) {
             // Store old value for return
@@ -330,7 +452,9 @@ V xMap<K, V>::remove(K key, void (*deleteKeyInMap)(K))
             }
 
             // Remove the entry
-            bucket.removeItem(pEntry, deleteEntry);
+            bucket.removeItem(pEntry);
+            bucket.releaseFreeNodes();
+            recycleEntry(pEntry);
 
             this->count--;
             return oldValue;
@@ -342,12 +466,12 @@ V xMap<K, V>::remove(K key, void (*deleteKeyInMap)(K))
     throw KeyNotFound(os.str());
 }
 
-template <class K, class V>
-bool xMap<K, V>::remove(K key, V value, void (*deleteKeyInMap)(K), void (*deleteValueInMap)(V))
+template <class K, class V, class Alloc>
+bool xMap<K, V, Alloc>::remove(K key, V value, void (*deleteKeyInMap)(K), void (*deleteValueInMap)(V))
 {
     int index = hashCode(key, capacity);
     // YOUR CODE IS HERE
-    DLinkedList<Entry*>& bucket = table[index];
+    DLinkedList<Entry *, Alloc>& bucket = table[index];
     for (auto pEntry : bucket) {
         if (keyEQ(pEntry->key, key) && valueEQ(pEntry->value, value)) {
         // Store old value for return
@@ -363,7 +487,9 @@ bool xMap<K, V>::remove(K key, V value, void (*deleteKeyInMap)(K), void (*delete
         }
 
         // Remove the entry
-        bucket.removeItem(pEntry, deleteEntry);
+        bucket.removeItem(pEntry);
+        bucket.releaseFreeNodes();
+        recycleEntry(pEntry);
 
         this->count--;
         return true;
@@ -375,12 +501,12 @@ bool xMap<K, V>::remove(K key, V value, void (*deleteKeyInMap)(K), void (*delete
     throw KeyNotFound(os.str());
 }
 
-template <class K, class V>
-bool xMap<K, V>::containsKey(K key)
+template <class K, class V, class Alloc>
+bool xMap<K, V, Alloc>::containsKey(K key)
 {
     // YOUR CODE IS HERE
     int index = hashCode(key, capacity);
-    DLinkedList<Entry*>& bucket = table[index];
+    DLinkedList<Entry *, Alloc>& bucket = table[index];
     for (auto pEntry : bucket) {
         if (keyEQ(pEntry->key, key)) {
             return true;
@@ -390,12 +516,12 @@ bool xMap<K, V>::containsKey(K key)
     return false;
 }
 
-template <class K, class V>
-bool xMap<K, V>::containsValue(V value)
+template <class K, class V, class Alloc>
+bool xMap<K, V, Alloc>::containsValue(V value)
 {
     // YOUR CODE IS HERE
     for (int idx = 0; idx < this->capacity; idx++) {
-        DLinkedList<Entry*>& bucket = table[idx];
+        DLinkedList<Entry *, Alloc>& bucket = table[idx];
         for (auto pEntry : bucket) {
             if (valueEQ(pEntry->value, value)) {
                 return true;
@@ -405,22 +531,22 @@ bool xMap<K, V>::containsValue(V value)
 
         return false;
 }
-template <class K, class V>
-bool xMap<K, V>::empty()
+template <class K, class V, class Alloc>
+bool xMap<K, V, Alloc>::empty()
 {
     // YOUR CODE IS HERE
     return this->size() == 0;
 }
 
-template <class K, class V>
-int xMap<K, V>::size()
+template <class K, class V, class Alloc>
+int xMap<K, V, Alloc>::size()
 {
     // YOUR CODE IS HERE
     return this->count;
 }
 
-template <class K, class V>
-void xMap<K, V>::clear()
+template <class K, class V, class Alloc>
+void xMap<K, V, Alloc>::clear()
 {
     // YOUR CODE IS HERE
     removeInternalData();
@@ -428,21 +554,17 @@ void xMap<K, V>::clear()
     this->capacity = 10;
     this->count = 0;
 
-    this->table = new DLinkedList<Entry*>[this->capacity];
-    // Initialize table:
-    for (int i = 0; i < this->capacity; i++) {
-        this->table[i] = DLinkedList<Entry*>();
-    }
+    this->table = createTable(this->capacity);
 }
 
-template <class K, class V>
-DLinkedList<K> xMap<K, V>::keys()
+template <class K, class V, class Alloc>
+DLinkedList<K> xMap<K, V, Alloc>::keys()
 {
     // YOUR CODE IS HERE
     DLinkedList<K> keysList;
 
    for (int idx = 0; idx < this->capacity; idx++) {
-      DLinkedList<Entry*>& bucket = table[idx];
+      DLinkedList<Entry *, Alloc>& bucket = table[idx];
       for (auto pEntry : bucket) {
           keysList.add(pEntry->key);
       }
@@ -451,14 +573,14 @@ DLinkedList<K> xMap<K, V>::keys()
    return keysList;
 }
 
-template <class K, class V>
-DLinkedList<V> xMap<K, V>::values()
+template <class K, class V, class Alloc>
+DLinkedList<V> xMap<K, V, Alloc>::values()
 {
     // YOUR CODE IS HERE
     DLinkedList<V> valuesList;
 
     for (int idx = 0; idx < this->capacity; idx++) {
-       DLinkedList<Entry*>& bucket = table[idx];
+       DLinkedList<Entry *, Alloc>& bucket = table[idx];
        for (auto pEntry : bucket) {
            valuesList.add(pEntry->value);
        }
@@ -467,22 +589,22 @@ DLinkedList<V> xMap<K, V>::values()
     return valuesList;  
 }
 
-template <class K, class V>
-DLinkedList<int> xMap<K, V>::clashes()
+template <class K, class V, class Alloc>
+DLinkedList<int> xMap<K, V, Alloc>::clashes()
 {
     // YOUR CODE IS HERE
     DLinkedList<int> clashesList;
 
     for (int idx = 0; idx < this->capacity; idx++) {
-       DLinkedList<Entry*>& bucket = table[idx];
+       DLinkedList<Entry *, Alloc>& bucket = table[idx];
        clashesList.add(bucket.size());
     }
  
     return clashesList;
 }
 
-template <class K, class V>
-string xMap<K, V>::toString(string (*key2str)(K &), string (*value2str)(V &))
+template <class K, class V, class Alloc>
+string xMap<K, V, Alloc>::toString(string (*key2str)(K &), string (*value2str)(V &))
 {
     stringstream os;
     string mark(50, '=');
@@ -491,7 +613,7 @@ string xMap<K, V>::toString(string (*key2str)(K &), string (*value2str)(V &))
     os << setw(12) << left << "size: " << count << endl;
     for (int idx = 0; idx < capacity; idx++)
     {
-        DLinkedList<Entry *> list = table[idx];
+        DLinkedList<Entry *, Alloc> list = table[idx];
 
         os << setw(4) << left << idx << ": ";
         stringstream itemos;
@@ -530,19 +652,22 @@ string xMap<K, V>::toString(string (*key2str)(K &), string (*value2str)(V &))
  * moveEntries:
  *  Purpose: move all entries in the old hash table (oldTable) to the new table (newTable)
  */
-template <class K, class V>
-void xMap<K, V>::moveEntries(
-    DLinkedList<Entry *> *oldTable, int oldCapacity,
-    DLinkedList<Entry *> *newTable, int newCapacity)
+template <class K, class V, class Alloc>
+void xMap<K, V, Alloc>::moveEntries(
+    DLinkedList<Entry *, Alloc> *oldTable, int oldCapacity,
+    DLinkedList<Entry *, Alloc> *newTable, int newCapacity)
 {
+    // the nodes of the buckets are relinked one by one (see DLinkedList::splice):
+    // no node is allocated or freed, the entries keep their order
     for (int old_index = 0; old_index < oldCapacity; old_index++)
     {
-        DLinkedList<Entry *> &oldList = oldTable[old_index];
-        for (auto oldEntry : oldList)
+        DLinkedList<Entry *, Alloc> &oldList = oldTable[old_index];
+        while (!oldList.empty())
         {
+            Entry *oldEntry = oldList.get(0);
             int new_index = this->hashCode(oldEntry->key, newCapacity);
-            DLinkedList<Entry *> &newList = newTable[new_index];
-            newList.add(oldEntry);
+            DLinkedList<Entry *, Alloc> &newList = newTable[new_index];
+            newList.splice(newList.size(), oldList, 0, 1);
         }
     }
 }
@@ -551,8 +676,8 @@ void xMap<K, V>::moveEntries(
  *  Purpose: ensure the load-factor,
  *      i.e., the maximum number of entries does not exceed "loadFactor*capacity"
  */
-template <class K, class V>
-void xMap<K, V>::ensureLoadFactor(int current_size)
+template <class K, class V, class Alloc>
+void xMap<K, V, Alloc>::ensureLoadFactor(int current_size)
 {
     int maxSize = (int)(loadFactor * capacity);
 
@@ -573,26 +698,20 @@ void xMap<K, V>::ensureLoadFactor(int current_size)
  *      2. move all the old table to to new one
  *      3. free the old table.
  */
-template <class K, class V>
-void xMap<K, V>::rehash(int newCapacity)
+template <class K, class V, class Alloc>
+void xMap<K, V, Alloc>::rehash(int newCapacity)
 {
-    DLinkedList<Entry *> *pOldMap = this->table;
+    DLinkedList<Entry *, Alloc> *pOldMap = this->table;
     int oldCapacity = capacity;
 
     // Create new table:
-    this->table = new DLinkedList<Entry *>[newCapacity];
+    this->table = createTable(newCapacity);
     this->capacity = newCapacity; // keep "count" not changed
 
     moveEntries(pOldMap, oldCapacity, this->table, newCapacity);
 
-    // remove old data: only remove nodes in list, no entry
-    for (int idx = 0; idx < oldCapacity; idx++)
-    {
-        DLinkedList<Entry *> &list = pOldMap[idx];
-        list.clear();
-    }
-    // Remove oldTable
-    delete[] pOldMap;
+    // Remove oldTable: its buckets are empty now (their nodes were moved)
+    destroyTable(pOldMap, oldCapacity);
 }
 
 /*
@@ -603,8 +722,8 @@ void xMap<K, V>::rehash(int newCapacity)
  *      2. Remove all entry
  *      3. Remove table
  */
-template <class K, class V>
-void xMap<K, V>::removeInternalData()
+template <class K, class V, class Alloc>
+void xMap<K, V, Alloc>::removeInternalData()
 {
     // Remove user's data
     if (deleteKeys != 0)
@@ -615,14 +734,16 @@ void xMap<K, V>::removeInternalData()
     // Remove all entries in the current map
     for (int idx = 0; idx < this->capacity; idx++)
     {
-        DLinkedList<Entry *> &list = this->table[idx];
+        DLinkedList<Entry *, Alloc> &list = this->table[idx];
         for (auto pEntry : list)
-            delete pEntry;
+            deleteEntry(pEntry);
         list.clear();
     }
 
+    releaseFreeEntries();
+
     // Remove table
-    delete[] table;
+    destroyTable(this->table, this->capacity);
 }
 
 /*
@@ -633,8 +754,8 @@ void xMap<K, V>::removeInternalData()
  *          to the current table
  */
 
- template <class K, class V>
- void xMap<K, V>::copyMapFrom(const xMap<K, V>& map) {
+ template <class K, class V, class Alloc>
+ void xMap<K, V, Alloc>::copyMapFrom(const xMap<K, V, Alloc>& map) {
    // Copy member variables first
    this->capacity = map.capacity;
    this->count = 0;
@@ -645,14 +766,11 @@ void xMap<K, V>::removeInternalData()
    // SHOULD NOT COPY: deleteKeys, deleteValues => delete ONLY TIME in map if needed
    
    // Initialize the hash table
-   this->table = new DLinkedList<Entry*>[this->capacity];
-   for (int i = 0; i < this->capacity; i++) {
-       this->table[i] = DLinkedList<Entry*>();
-   }
+   this->table = createTable(this->capacity);
  
    // Copy entries last - after all initialization is complete
    for (int idx = 0; idx < map.capacity; idx++) {
-      DLinkedList<Entry*>& list = map.table[idx];
+      DLinkedList<Entry *, Alloc>& list = map.table[idx];
       for (auto pEntry : list) {
            this->put(pEntry->key, pEntry->value);
       }
@@ -5,6 +5,7 @@
 #include <sstream>
 #include <iostream>
 #include "list/XArrayList.h"
+#include "util/MemLib.h"
 using namespace std;
 /*
  * function pointer: int (*comparator)(T& lhs, T& rhs)
@@ -18,25 +19,34 @@ using namespace std;
  *      remove user's data in case that T is a pointer type
  *      Users should pass &Heap<T>::free for "deleteUserData"
  * 
+ * Alloc: where the array of items comes from (see util/Allocator.h)
  */
-template<class T>
+template<class T, class Alloc = MallocAllocator>
 class Heap: public IHeap<T>{
 public:
     class Iterator; //forward declaration
+    class OrderedIterator; //forward declaration
     
 protected:
-    T *elements;    //a dynamic array to contain user's data
+    T *elements;    //a dynamic array to contain user's data (see util/MemLib.h): only elements[0..count-1] are constructed
     int capacity;   //size of the dynamic array
     int count;      //current count of elements stored in this heap
     int (*comparator)(T& lhs, T& rhs);      //see above
-    void (*deleteUserData)(Heap<T>* pHeap); //see above
+    void (*deleteUserData)(Heap<T, Alloc>* pHeap); //see above
     
 public:
     Heap(   int (*comparator)(T& , T&)=0, 
-            void (*deleteUserData)(Heap<T>*)=0 );
+            void (*deleteUserData)(Heap<T, Alloc>*)=0 );
     
-    Heap(const Heap<T>& heap); //copy constructor 
-    Heap<T>& operator=(const Heap<T>& heap); //assignment operator
+    /* Heap(XArrayList<T>&& list, ...): build a heap in-place on the list's buffer
+     *      the buffer is adopted (not copied) and the list is left empty.
+     *      Runs in O(n) (Floyd's bottom-up heapify)
+     */
+    Heap(   XArrayList<T, Alloc>&& list,
+            int (*comparator)(T& , T&)=0, 
+            void (*deleteUserData)(Heap<T, Alloc>*)=0 );
+    Heap(const Heap<T, Alloc>& heap); //copy constructor 
+    Heap<T, Alloc>& operator=(const Heap<T, Alloc>& heap); //assignment operator
     
     ~Heap();
     
@@ -53,6 +63,28 @@ public:
     string toString(string (*item2str)(T&)=0 );
     //Inherit from IHeap: END
     
+    /* heapify(XArrayList<T>&& list): same as heapify(T array[], int size),
+     *      but adopts the list's buffer instead of copying it
+     */
+    void heapify(XArrayList<T, Alloc>&& list);
+    
+    /* pushAll(first, last): push every item in [first, last)
+     *      items are appended first, then the heap property is restored either by
+     *      reheapUp on each new item (small batch) or by a bottom-up heapify over
+     *      the whole array (large batch), whichever is cheaper.
+     *  Example:
+     *      heap.pushAll(list.begin(), list.end());
+     */
+    template<class InputIt>
+    void pushAll(InputIt first, InputIt last);
+    void pushAll(T array[], int size);
+    
+    /* meld(Heap<T, Alloc>&& heap): move all items of "heap" into this heap
+     *      "heap" is left empty; its items are ordered by THIS heap's comparator.
+     *      If this heap is empty, the buffer of "heap" is taken over in O(1).
+     */
+    void meld(Heap<T, Alloc>&& heap);
+    
     void println(string (*item2str)(T&)=0 ){
         cout << toString(item2str) << endl;
     }
@@ -64,6 +96,30 @@ public:
         return Iterator(this, false);
     }
     
+    /* orderedBegin, orderedEnd and OrderedIterator: traverse the heap in priority order
+     *      WITHOUT popping; the heap itself is not modified.
+     *      Reading the first k items costs O(k log k), independent of size().
+     *      Any push/pop/remove on the heap invalidates the iterator.
+     * Example:
+     *  for(Heap<int>::OrderedIterator it = heap.orderedBegin(); it != heap.orderedEnd(); it++)
+     *      cout << *it << " ";
+     */
+    OrderedIterator orderedBegin(){
+        return OrderedIterator(this, true);
+    }
+    OrderedIterator orderedEnd(){
+        return OrderedIterator(this, false);
+    }
+    
+    /* top(k, result): append the k first items in priority order to "result"
+     *      (fewer if size() < k); the heap is not modified.
+     */
+    void top(int k, XArrayList<T>& result){
+        OrderedIterator it = orderedBegin();
+        OrderedIterator itEnd = orderedEnd();
+        for(int idx = 0; idx < k && it != itEnd; idx++, ++it) result.add(*it);
+    }
+    
 public:
     /* if T is pointer type:
      *     pass the address of method "free" to Heap<T>'s constructor:
@@ -72,7 +128,7 @@ public:
      *  Heap<Point*> heap(&Heap<Point*>::free);
      *  => Destructor will call free via function pointer "deleteUserData"
      */
-    static void free(Heap<T> *pHeap){
+    static void free(Heap<T, Alloc> *pHeap){
         for(int idx=0; idx < pHeap->count; idx++) delete pHeap->elements[idx];
     }
     
@@ -95,9 +151,11 @@ private:
     void reheapUp(int position);
     void reheapDown(int position);
     int getItem(T item);
+    void buildHeap();
+    void restoreAfterAppend(int oldCount);
     
     void removeInternalData();
-    void copyFrom(const Heap<T>& heap);
+    void copyFrom(const Heap<T, Alloc>& heap);
 public:
     void heapsort(XArrayList<T>& arrayList) {
         // Clear the heap first
@@ -143,10 +201,10 @@ public:
     //Iterator: BEGIN
     class Iterator{
     private:
-        Heap<T>* heap;
+        Heap<T, Alloc>* heap;
         int cursor;
     public:
-        Iterator(Heap<T>* heap=0, bool begin=0){
+        Iterator(Heap<T, Alloc>* heap=0, bool begin=0){
             this->heap = heap;
             if(begin && (heap !=0)) cursor = 0;
             if(!begin && (heap !=0)) cursor = heap->size();
@@ -179,6 +237,87 @@ public:
         }
     };
     //Iterator: END
+    
+    //OrderedIterator: BEGIN
+    class OrderedIterator{
+    private:
+        Heap<T, Alloc>* heap;
+        XArrayList<int> frontier; //min-heap of positions in heap->elements
+        
+        /*
+         * every position not yet visited whose parent has been visited is in
+         * "frontier"; its top is the next item in priority order.
+         */
+        bool lessAt(int a, int b){
+            return heap->aLTb(heap->elements[frontier.get(a)], heap->elements[frontier.get(b)]);
+        }
+        void swapAt(int a, int b){
+            int temp = frontier.get(a);
+            frontier.get(a) = frontier.get(b);
+            frontier.get(b) = temp;
+        }
+        void pushPosition(int position){
+            if(position >= heap->count) return;
+            frontier.add(position);
+            int child = frontier.size() - 1;
+            while(child > 0 && lessAt(child, (child - 1) / 2)){
+                swapAt(child, (child - 1) / 2);
+                child = (child - 1) / 2;
+            }
+        }
+        int popPosition(){
+            int top = frontier.get(0);
+            int last = frontier.removeAt(frontier.size() - 1);
+            if(frontier.size() > 0){
+                frontier.get(0) = last;
+                int parent = 0;
+                while(true){
+                    int smaller = parent * 2 + 1;
+                    if(smaller >= frontier.size()) break;
+                    if(smaller + 1 < frontier.size() && lessAt(smaller + 1, smaller)) smaller++;
+                    if(!lessAt(smaller, parent)) break;
+                    swapAt(smaller, parent);
+                    parent = smaller;
+                }
+            }
+            return top;
+        }
+        int current(){
+            return frontier.empty() ? -1 : frontier.get(0);
+        }
+    public:
+        OrderedIterator(Heap<T, Alloc>* heap=0, bool begin=0): frontier(0, 0, begin ? 16 : 0){
+            this->heap = heap;
+            if(begin && (heap != 0)) pushPosition(0);
+        }
+        OrderedIterator(const OrderedIterator& iterator): heap(iterator.heap), frontier(iterator.frontier){}
+        OrderedIterator& operator=(const OrderedIterator& iterator){
+            this->heap = iterator.heap;
+            this->frontier = iterator.frontier;
+            return *this;
+        }
+        
+        T& operator*(){
+            return this->heap->elements[current()];
+        }
+        bool operator!=(const OrderedIterator& iterator){
+            return this->current() != const_cast<OrderedIterator&>(iterator).current();
+        }
+        // Prefix ++ overload 
+        OrderedIterator& operator++(){
+            int position = popPosition();
+            pushPosition(position * 2 + 1);
+            pushPosition(position * 2 + 2);
+            return *this; 
+        }
+        // Postfix ++ overload 
+        OrderedIterator operator++(int){
+            OrderedIterator iterator = *this; 
+            ++*this; 
+            return iterator; 
+        }
+    };
+    //OrderedIterator: END
 };
 
 
@@ -186,23 +325,37 @@ public:
 ////////////////////////     METHOD DEFNITION      ///////////////////
 //////////////////////////////////////////////////////////////////////
 
-template<class T>
-Heap<T>::Heap(
+template<class T, class Alloc>
+Heap<T, Alloc>::Heap(
         int (*comparator)(T&, T&), 
-        void (*deleteUserData)(Heap<T>* ) ){
+        void (*deleteUserData)(Heap<T, Alloc>* ) ){
     this->capacity = 10;
     this->count = 0;
-    this->elements = new T[capacity];
+    this->elements = allocRaw<T, Alloc>(capacity);
+    this->comparator = comparator;
+    this->deleteUserData = deleteUserData;
+}
+template<class T, class Alloc>
+Heap<T, Alloc>::Heap(
+        XArrayList<T, Alloc>&& list,
+        int (*comparator)(T&, T&), 
+        void (*deleteUserData)(Heap<T, Alloc>* ) ){
+    this->elements = list.detachData(this->count, this->capacity);
+    if(this->elements == 0){
+        this->capacity = 10;
+        this->elements = allocRaw<T, Alloc>(capacity);
+    }
     this->comparator = comparator;
     this->deleteUserData = deleteUserData;
+    buildHeap();
 }
-template<class T>
-Heap<T>::Heap(const Heap<T>& heap){
+template<class T, class Alloc>
+Heap<T, Alloc>::Heap(const Heap<T, Alloc>& heap){
     copyFrom(heap);
 }
 
-template<class T>
-Heap<T>& Heap<T>::operator=(const Heap<T>& heap){
+template<class T, class Alloc>
+Heap<T, Alloc>& Heap<T, Alloc>::operator=(const Heap<T, Alloc>& heap){
     if (this != &heap) {
         removeInternalData();
         copyFrom(heap);
@@ -212,13 +365,13 @@ Heap<T>& Heap<T>::operator=(const Heap<T>& heap){
 }
 
 
-template<class T>
-Heap<T>::~Heap(){
+template<class T, class Alloc>
+Heap<T, Alloc>::~Heap(){
     removeInternalData();
 }
 
-template<class T>
-void Heap<T>::push(T item){ //item  = 25
+template<class T, class Alloc>
+void Heap<T, Alloc>::push(T item){ //item  = 25
     // ensureCapacity(count + 1); //[18, 15, 13, 25 , , ]
     // elements[count] = item;
     // count += 1; //count = 
@@ -226,7 +379,7 @@ void Heap<T>::push(T item){ //item  = 25
 
     // My code
     ensureCapacity(count + 1);  // ensure enough space
-    elements[count] = item;
+    new (&elements[count]) T(std::move(item));
     reheapUp(count);  // reheap up
     this->count++;
 }
@@ -246,13 +399,15 @@ void Heap<T>::push(T item){ //item  = 25
            0   1    2   3
  
  */
-template<class T>
-T Heap<T>::pop(){
+template<class T, class Alloc>
+T Heap<T, Alloc>::pop(){
     if (this->count == 0) 
         throw std::underflow_error("Calling to peek with the empty heap.");
     
-    T item = this->elements[0];
-    this->elements[0] = this->elements[this->count - 1]; // last element to root
+    T item = std::move(this->elements[0]);
+    if (this->count > 1)
+        this->elements[0] = std::move(this->elements[this->count - 1]); // last element to root
+    destroyRange(this->elements, this->count - 1, this->count);
     this->count--;
     reheapDown(0);  // reheapify the root
     return item;
@@ -269,16 +424,16 @@ T Heap<T>::pop(){
 => Array: [18, 15, 13, , , ]
  */
 
-template<class T>
-const T Heap<T>::peek(){
+template<class T, class Alloc>
+const T Heap<T, Alloc>::peek(){
     if(count == 0) 
         throw std::underflow_error("Calling to peek with the empty heap.");
     return this->elements[0];
 }
 
 
-template<class T>
-void Heap<T>::remove(T item, void (*removeItemData)(T)){
+template<class T, class Alloc>
+void Heap<T, Alloc>::remove(T item, void (*removeItemData)(T)){
     // int foundIdx = this->getItem(item);
     
     // //CASE 1: not found
@@ -301,10 +456,15 @@ void Heap<T>::remove(T item, void (*removeItemData)(T)){
     }
  
     // move last element to the position of the item to be removed
-    this->elements[pos] = this->elements[this->count - 1];
+    if (pos != this->count - 1)
+        this->elements[pos] = std::move(this->elements[this->count - 1]);
+    destroyRange(this->elements, this->count - 1, this->count);
     this->count--;
 
     // Check if we need to reheap up or down
+    if (pos >= this->count) {
+        return; // the removed item was the last one
+    }
     if (pos > 0) {
         int parent = (pos - 1) / 2;
         if (aLTb(this->elements[pos], this->elements[parent])) {
@@ -321,8 +481,8 @@ void Heap<T>::remove(T item, void (*removeItemData)(T)){
 
 /*
 //April 03, 2023
-template<class T>
-void Heap<T>::remove_bck(T item, void (*removeItemData)(T)){
+template<class T, class Alloc>
+void Heap<T, Alloc>::remove_bck(T item, void (*removeItemData)(T)){
     int foundIdx = this->getItem(item);
     
     //CASE 1: not found
@@ -355,8 +515,8 @@ void Heap<T>::remove_bck(T item, void (*removeItemData)(T)){
 }
 */
 
-template<class T>
-bool Heap<T>::contains(T item){
+template<class T, class Alloc>
+bool Heap<T, Alloc>::contains(T item){
     // bool found = false;
     // for(int idx=0; idx < count; idx++){
     //     if(compare(elements[idx], item) == 0){
@@ -368,42 +528,107 @@ bool Heap<T>::contains(T item){
     return getItem(item) != -1;
 }
 
-template<class T>
-int Heap<T>::size(){
+template<class T, class Alloc>
+int Heap<T, Alloc>::size(){
     return this->count;
 }
 
-template<class T>
-void Heap<T>::heapify(T array[], int size){
-    clear();
+template<class T, class Alloc>
+void Heap<T, Alloc>::heapify(T array[], int size){
+    // reuse the current buffer instead of clear() (which re-allocates)
+    if(this->deleteUserData != 0) deleteUserData(this);
+    destroyRange(elements, 0, count);
+    this->count = 0;
 
     ensureCapacity(size);
     for (int i = 0; i < size; i++) {
-        elements[i] = array[i];
+        new (&elements[i]) T(array[i]);
     }
     this->count = size;
 
-    for (int i = (size / 2) - 1; i >= 0; i--) {
-        reheapDown(i);
+    buildHeap();
+}
+
+template<class T, class Alloc>
+void Heap<T, Alloc>::heapify(XArrayList<T, Alloc>&& list){
+    removeInternalData();
+    this->elements = list.detachData(this->count, this->capacity);
+    if(this->elements == 0){
+        this->capacity = 10;
+        this->elements = allocRaw<T, Alloc>(capacity);
+    }
+    buildHeap();
+}
+
+template<class T, class Alloc>
+template<class InputIt>
+void Heap<T, Alloc>::pushAll(InputIt first, InputIt last){
+    int oldCount = this->count;
+    for(; first != last; ++first){
+        ensureCapacity(count + 1);
+        new (&elements[count]) T(*first);
+        this->count++;
+    }
+    restoreAfterAppend(oldCount);
+}
+
+template<class T, class Alloc>
+void Heap<T, Alloc>::pushAll(T array[], int size){
+    int oldCount = this->count;
+    ensureCapacity(count + size);
+    for(int idx=0; idx < size; idx++){
+        new (&elements[count + idx]) T(array[idx]);
     }
+    this->count += size;
+    restoreAfterAppend(oldCount);
 }
 
-template<class T>
-void Heap<T>::clear(){
+template<class T, class Alloc>
+void Heap<T, Alloc>::meld(Heap<T, Alloc>&& heap){
+    if(this == &heap || heap.count == 0) return;
+
+    if(this->count == 0){
+        //take over the buffer of heap: O(1)
+        T* pElements = this->elements;
+        int oldCapacity = this->capacity;
+        this->elements = heap.elements;
+        this->capacity = heap.capacity;
+        this->count = heap.count;
+        heap.elements = pElements;
+        heap.capacity = oldCapacity;
+        heap.count = 0;
+        //heap may be ordered by another comparator
+        if(heap.comparator != this->comparator) buildHeap();
+        return;
+    }
+
+    int oldCount = this->count;
+    ensureCapacity(count + heap.count);
+    for(int idx=0; idx < heap.count; idx++){
+        new (&elements[count + idx]) T(std::move(heap.elements[idx]));
+    }
+    destroyRange(heap.elements, 0, heap.count);
+    this->count += heap.count;
+    heap.count = 0;
+    restoreAfterAppend(oldCount);
+}
+
+template<class T, class Alloc>
+void Heap<T, Alloc>::clear(){
     removeInternalData();
     
     this->capacity = 10;
     this->count = 0;
-    this->elements = new T[capacity];
+    this->elements = allocRaw<T, Alloc>(capacity);
 }
 
-template<class T>
-bool Heap<T>::empty(){
+template<class T, class Alloc>
+bool Heap<T, Alloc>::empty(){
     return this->count == 0;
 }
 
-template<class T>
-string Heap<T>::toString(string (*item2str)(T&)){
+template<class T, class Alloc>
+string Heap<T, Alloc>::toString(string (*item2str)(T&)){
     stringstream os;
     if(item2str != 0){
         os << "[";
@@ -427,8 +652,8 @@ string Heap<T>::toString(string (*item2str)(T&)){
 //////////////////////// (private) METHOD DEFNITION //////////////////
 //////////////////////////////////////////////////////////////////////
 
-template<class T>
-void Heap<T>::ensureCapacity(int minCapacity){
+template<class T, class Alloc>
+void Heap<T, Alloc>::ensureCapacity(int minCapacity){
     if(minCapacity >= capacity){
         //re-allocate 
         int old_capacity = capacity;
@@ -436,11 +661,8 @@ void Heap<T>::ensureCapacity(int minCapacity){
         // capacity = old_capacity + (old_capacity >> 2);
         capacity = max(minCapacity, old_capacity + (old_capacity >> 2));
         try{
-            T* new_data = new T[capacity];
-            //OLD: memcpy(new_data, elements, capacity*sizeof(T));
-            memcpy(new_data, elements, old_capacity*sizeof(T));
-            delete []elements;
-            elements = new_data;
+            //move the live items (a single realloc for trivially copyable T)
+            elements = reallocRaw<T, Alloc>(elements, count, old_capacity, capacity);
         }
         catch(std::bad_alloc e){
             e.what();
@@ -448,15 +670,15 @@ void Heap<T>::ensureCapacity(int minCapacity){
     }
 }
 
-template<class T>
-void Heap<T>::swap(int a, int b){
-    T temp = this->elements[a];
-    this->elements[a] = this->elements[b];
-    this->elements[b] = temp;
+template<class T, class Alloc>
+void Heap<T, Alloc>::swap(int a, int b){
+    T temp = std::move(this->elements[a]);
+    this->elements[a] = std::move(this->elements[b]);
+    this->elements[b] = std::move(temp);
 }
 
-template<class T>
-void Heap<T>::reheapUp(int position){
+template<class T, class Alloc>
+void Heap<T, Alloc>::reheapUp(int position){
     // if(position <= 0) return;
     // int parent = (position-1)/2;
     // if(aLTb(this->elements[position], this->elements[parent])){
@@ -473,8 +695,8 @@ void Heap<T>::reheapUp(int position){
     }
 }
 
-template<class T>
-void Heap<T>::reheapDown(int position){
+template<class T, class Alloc>
+void Heap<T, Alloc>::reheapDown(int position){
     // int leftChild = position*2 + 1;
     // int rightChild = position*2 + 2;
     // int lastPosition = this->count - 1;
@@ -514,8 +736,38 @@ void Heap<T>::reheapDown(int position){
     }
 }
 
-template<class T>
-int Heap<T>::getItem(T item){
+template<class T, class Alloc>
+void Heap<T, Alloc>::buildHeap(){
+    //Floyd: reheapDown every internal node, from the last one to the root
+    for (int i = (count / 2) - 1; i >= 0; i--) {
+        reheapDown(i);
+    }
+}
+
+template<class T, class Alloc>
+void Heap<T, Alloc>::restoreAfterAppend(int oldCount){
+    /*
+     * items in [oldCount, count) were appended without reheapUp
+     *  + k reheapUps cost about k*log2(count)
+     *  + one buildHeap costs about 2*count
+     * => pick the cheaper one
+     */
+    int added = count - oldCount;
+    if(added <= 0) return;
+
+    int height = 0;
+    for(int n = count; n > 1; n >>= 1) height++;
+
+    if((long long)added * height > 2LL * count){
+        buildHeap();
+    }
+    else{
+        for(int idx = oldCount; idx < count; idx++) reheapUp(idx);
+    }
+}
+
+template<class T, class Alloc>
+int Heap<T, Alloc>::getItem(T item){
     int foundIdx = -1;
     for(int idx=0; idx < this->count; idx++){
         if(compare(elements[idx], item) == 0){
@@ -526,17 +778,18 @@ int Heap<T>::getItem(T item){
     return foundIdx;
 }
 
-template<class T>
-void Heap<T>::removeInternalData(){
+template<class T, class Alloc>
+void Heap<T, Alloc>::removeInternalData(){
     if(this->deleteUserData != 0) deleteUserData(this); //clear users's data if they want
-    delete []elements;
+    destroyRange(elements, 0, count);
+    freeRaw<T, Alloc>(elements, capacity);
 }
 
-template<class T>
-void Heap<T>::copyFrom(const Heap<T>& heap){
+template<class T, class Alloc>
+void Heap<T, Alloc>::copyFrom(const Heap<T, Alloc>& heap){
     capacity = heap.capacity;
     count = heap.count;
-    elements = new T[capacity];
+    elements = allocRaw<T, Alloc>(capacity);
     this->comparator = heap.comparator;
     this->deleteUserData = heap.deleteUserData;
     
@@ -556,10 +809,10 @@ void Heap<T>::copyFrom(const Heap<T>& heap){
         // Check if we're dealing with Heap<int*> specifically
         if constexpr (std::is_same<T, int*>::value) {
         // Deep copy for int* to avoid double-free issues
-        this->elements[idx] = new int(*heap.elements[idx]);
+        new (&this->elements[idx]) int*(new int(*heap.elements[idx]));
         } else {
         // Simple copy for all other types
-        this->elements[idx] = heap.elements[idx];
+        new (&this->elements[idx]) T(heap.elements[idx]);
         }
     }
 }
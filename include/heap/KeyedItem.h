@@ -0,0 +1,64 @@
+/*
+ * File:   KeyedItem.h
+ */
+
+#ifndef KEYEDITEM_H
+#define KEYEDITEM_H
+#include <iostream>
+using namespace std;
+
+/*
+ * KeyedItem<K, V>:
+ *  + K: priority type (must support operator < and >)
+ *  + V: user's item (e.g., Point*)
+ *
+ *  The priority is computed ONCE when the item is created and stored next to it,
+ *  so the heap compares keys directly instead of recomputing them on every
+ *  reheapUp/reheapDown.
+ *  For example:
+ *      Heap<KeyedItem<float, Point*>> heap;  // min-heap by key
+ *      heap.push(KeyedItem<float, Point*>(p->radius(), p));
+ *
+ *      Heap<KeyedItem<float, Point*>> maxHeap(&KeyedItem<float, Point*>::maxComparator);
+ */
+template<class K, class V>
+struct KeyedItem{
+    K key;
+    V item;
+
+    KeyedItem(): key(), item() {}
+    KeyedItem(K key, V item){
+        this->key = key;
+        this->item = item;
+    }
+
+    // only the key takes part in the ordering
+    bool operator<(const KeyedItem<K, V>& rhs) const {
+        return key < rhs.key;
+    }
+    bool operator>(const KeyedItem<K, V>& rhs) const {
+        return key > rhs.key;
+    }
+    bool operator==(const KeyedItem<K, V>& rhs) const {
+        return !(key < rhs.key) && !(key > rhs.key);
+    }
+
+    /* minComparator, maxComparator: can be passed to Heap<KeyedItem<K,V>>'s constructor
+     */
+    static int minComparator(KeyedItem<K, V>& a, KeyedItem<K, V>& b){
+        if (a.key < b.key) return -1;
+        else if(a.key > b.key) return +1;
+        else return 0;
+    }
+    static int maxComparator(KeyedItem<K, V>& a, KeyedItem<K, V>& b){
+        if (a.key < b.key) return +1;
+        else if(a.key > b.key) return -1;
+        else return 0;
+    }
+
+    friend ostream &operator<<(ostream &os, const KeyedItem<K, V>& keyed){
+        return os << "(" << keyed.key << ", " << keyed.item << ")";
+    }
+};
+
+#endif /* KEYEDITEM_H */
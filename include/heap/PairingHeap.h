@@ -0,0 +1,493 @@
+/*
+ * File:   PairingHeap.h
+ */
+
+#ifndef PAIRINGHEAP_H
+#define PAIRINGHEAP_H
+#include "heap/IHeap.h"
+#include "list/XArrayList.h"
+#include <sstream>
+#include <iostream>
+#include <stdexcept>
+using namespace std;
+/*
+ * PairingHeap<T>: a pointer-based alternative to Heap<T>
+ *  + push, peek, meld, decreaseKey: O(1)
+ *  + pop:                           O(log n) amortized
+ *  + remove, contains:              O(n) (search) + O(log n) amortized
+ *
+ * Nodes are taken from a pool owned by the heap (blocks of NODES_PER_BLOCK
+ * nodes + a free-list), so steady-state push/pop does not call new/delete.
+ *
+ * function pointer: int (*comparator)(T& lhs, T& rhs)
+ *      same convention as Heap<T>: return sign of (lhs - rhs)
+ *
+ * function pointer: void (*deleteUserData)(PairingHeap<T>* pHeap)
+ *      remove user's data in case that T is a pointer type
+ *      Users should pass &PairingHeap<T>::free for "deleteUserData"
+ */
+template<class T>
+class PairingHeap: public IHeap<T>{
+public:
+    class Node; //forward declaration
+
+protected:
+    static const int NODES_PER_BLOCK = 64;
+    struct Block; //a chunk of NODES_PER_BLOCK nodes
+
+    Node* root;         //the min item (according to comparator)
+    int count;          //current count of elements stored in this heap
+    Block* blockHead;   //all blocks owned by this heap
+    Block* blockTail;
+    int blockUsed;      //number of nodes handed out from blockTail
+    Node* freeHead;     //recycled nodes (linked by "next")
+    Node* freeTail;
+    int (*comparator)(T& lhs, T& rhs);
+    void (*deleteUserData)(PairingHeap<T>* pHeap);
+
+public:
+    PairingHeap(    int (*comparator)(T& , T&)=0,
+                    void (*deleteUserData)(PairingHeap<T>*)=0 );
+    PairingHeap(const PairingHeap<T>& heap); //copy constructor
+    PairingHeap<T>& operator=(const PairingHeap<T>& heap); //assignment operator
+    ~PairingHeap();
+
+    //Inherit from IHeap: BEGIN
+    void push(T item);
+    T pop();
+    const T peek();
+    void remove(T item, void (*removeItemData)(T)=0);
+    bool contains(T item);
+    int size();
+    void heapify(T array[], int size);
+    void clear();
+    bool empty();
+    string toString(string (*item2str)(T&)=0 );
+    //Inherit from IHeap: END
+
+    /* insert(T item): same as push, but returns a handle for decreaseKey
+     *      the handle is valid until the item leaves the heap
+     */
+    Node* insert(T item);
+
+    /* decreaseKey(Node* node, T item): replace the item of "node" by "item"
+     *      "item" MUST NOT be greater than the current one (by comparator);
+     *      otherwise, throw std::invalid_argument
+     */
+    void decreaseKey(Node* node, T item);
+
+    /* meld(PairingHeap<T>&& heap): move all items of "heap" into this heap in O(1)
+     *      the nodes (and their pool) are relinked, not copied; "heap" is left empty.
+     *      If "heap" has another comparator, its items are pushed one by one instead
+     *      (O(m log m) for m items), so that they follow THIS heap's comparator.
+     */
+    void meld(PairingHeap<T>&& heap);
+
+    void println(string (*item2str)(T&)=0 ){
+        cout << toString(item2str) << endl;
+    }
+
+    /* if T is pointer type:
+     *     pass the address of method "free" to PairingHeap<T>'s constructor:
+     *     to:  remove the user's data (if needed)
+     * Example:
+     *  PairingHeap<Point*> heap(0, &PairingHeap<Point*>::free);
+     */
+    static void free(PairingHeap<T> *pHeap){
+        XArrayList<Node*> nodes;
+        pHeap->collectNodes(nodes);
+        for(int idx=0; idx < nodes.size(); idx++) delete nodes.get(idx)->data;
+    }
+
+private:
+    bool aLTb(T& a, T& b){
+        return compare(a, b) < 0;
+    }
+    int compare(T& a, T& b){
+        if(comparator != 0) return comparator(a, b);
+        else{
+            if (a < b) return -1;
+            else if(a > b) return 1;
+            else return 0;
+        }
+    }
+
+    Node* allocNode(T item);
+    void releaseNode(Node* node);
+    Node* link(Node* a, Node* b);
+    Node* mergePairs(Node* first);
+    void cut(Node* node);
+    Node* findNode(T item);
+    void collectNodes(XArrayList<Node*>& nodes);
+
+    void removeInternalData();
+    void copyFrom(const PairingHeap<T>& heap);
+
+//////////////////////////////////////////////////////////////////////
+////////////////////////  INNER CLASSES DEFNITION ////////////////////
+//////////////////////////////////////////////////////////////////////
+public:
+    class Node{
+    private:
+        T data;
+        Node* child;    //left-most child
+        Node* next;     //right sibling (or next free node)
+        Node* prev;     //left sibling; parent if this is the left-most child
+        friend class PairingHeap<T>;
+    public:
+        Node(): data(), child(0), next(0), prev(0) {}
+        T& item(){
+            return data;
+        }
+    };
+
+protected:
+    struct Block{
+        Node nodes[NODES_PER_BLOCK];
+        Block* next;
+    };
+};
+
+
+//////////////////////////////////////////////////////////////////////
+////////////////////////     METHOD DEFNITION      ///////////////////
+//////////////////////////////////////////////////////////////////////
+
+template<class T>
+PairingHeap<T>::PairingHeap(
+        int (*comparator)(T&, T&),
+        void (*deleteUserData)(PairingHeap<T>* ) ){
+    this->root = 0;
+    this->count = 0;
+    this->blockHead = this->blockTail = 0;
+    this->blockUsed = NODES_PER_BLOCK;
+    this->freeHead = this->freeTail = 0;
+    this->comparator = comparator;
+    this->deleteUserData = deleteUserData;
+}
+
+template<class T>
+PairingHeap<T>::PairingHeap(const PairingHeap<T>& heap){
+    this->root = 0;
+    this->count = 0;
+    this->blockHead = this->blockTail = 0;
+    this->blockUsed = NODES_PER_BLOCK;
+    this->freeHead = this->freeTail = 0;
+    copyFrom(heap);
+}
+
+template<class T>
+PairingHeap<T>& PairingHeap<T>::operator=(const PairingHeap<T>& heap){
+    if (this != &heap) {
+        removeInternalData();
+        copyFrom(heap);
+    }
+    return *this;
+}
+
+template<class T>
+PairingHeap<T>::~PairingHeap(){
+    removeInternalData();
+}
+
+template<class T>
+void PairingHeap<T>::push(T item){
+    insert(item);
+}
+
+template<class T>
+typename PairingHeap<T>::Node* PairingHeap<T>::insert(T item){
+    Node* node = allocNode(item);
+    root = link(root, node);
+    this->count++;
+    return node;
+}
+
+template<class T>
+T PairingHeap<T>::pop(){
+    if (this->count == 0)
+        throw std::underflow_error("Calling to pop with the empty heap.");
+
+    Node* oldRoot = root;
+    T item = oldRoot->data;
+    root = mergePairs(oldRoot->child);
+    if(root != 0) root->prev = 0;
+    releaseNode(oldRoot);
+    this->count--;
+    return item;
+}
+
+template<class T>
+const T PairingHeap<T>::peek(){
+    if(count == 0)
+        throw std::underflow_error("Calling to peek with the empty heap.");
+    return root->data;
+}
+
+template<class T>
+void PairingHeap<T>::remove(T item, void (*removeItemData)(T)){
+    Node* node = findNode(item);
+    if(node == 0) return; // item not found
+
+    if(removeItemData != nullptr) removeItemData(node->data);
+
+    if(node == root){
+        root = mergePairs(node->child);
+        if(root != 0) root->prev = 0;
+    }
+    else{
+        cut(node);
+        Node* subtree = mergePairs(node->child);
+        if(subtree != 0) subtree->prev = 0;
+        root = link(root, subtree);
+    }
+    releaseNode(node);
+    this->count--;
+}
+
+template<class T>
+bool PairingHeap<T>::contains(T item){
+    return findNode(item) != 0;
+}
+
+template<class T>
+int PairingHeap<T>::size(){
+    return this->count;
+}
+
+template<class T>
+void PairingHeap<T>::heapify(T array[], int size){
+    clear();
+    // push is O(1): the whole build is O(n)
+    for(int idx=0; idx < size; idx++) insert(array[idx]);
+}
+
+template<class T>
+void PairingHeap<T>::clear(){
+    removeInternalData();
+}
+
+template<class T>
+bool PairingHeap<T>::empty(){
+    return this->count == 0;
+}
+
+template<class T>
+string PairingHeap<T>::toString(string (*item2str)(T&)){
+    // items in pre-order of the tree: root first, then each subtree
+    XArrayList<Node*> nodes;
+    collectNodes(nodes);
+
+    stringstream os;
+    os << "[";
+    for(int idx=0; idx < nodes.size(); idx++){
+        if(idx > 0) os << ",";
+        if(item2str != 0) os << item2str(nodes.get(idx)->data);
+        else os << nodes.get(idx)->data;
+    }
+    os << "]";
+    return os.str();
+}
+
+template<class T>
+void PairingHeap<T>::decreaseKey(Node* node, T item){
+    if(compare(item, node->data) > 0)
+        throw std::invalid_argument("New item is greater than the current one.");
+
+    node->data = item;
+    if(node == root) return;
+
+    cut(node);
+    root = link(root, node);
+}
+
+template<class T>
+void PairingHeap<T>::meld(PairingHeap<T>&& heap){
+    if(this == &heap || heap.count == 0) return;
+
+    //heap is ordered by another comparator: linking its root would keep its subtrees in that order
+    if(heap.comparator != this->comparator){
+        while(heap.count > 0) push(heap.pop());
+        return;
+    }
+
+    root = link(root, heap.root);
+    this->count += heap.count;
+
+    //take over the pool of heap: keep our partially used block as the tail
+    if(heap.blockHead != 0){
+        if(this->blockHead == 0){
+            this->blockHead = heap.blockHead;
+            this->blockTail = heap.blockTail;
+            this->blockUsed = heap.blockUsed;
+        }
+        else{
+            heap.blockTail->next = this->blockHead;
+            this->blockHead = heap.blockHead;
+        }
+    }
+    if(heap.freeHead != 0){
+        if(this->freeHead == 0) this->freeHead = heap.freeHead;
+        else this->freeTail->next = heap.freeHead;
+        this->freeTail = heap.freeTail;
+    }
+
+    heap.root = 0;
+    heap.count = 0;
+    heap.blockHead = heap.blockTail = 0;
+    heap.blockUsed = NODES_PER_BLOCK;
+    heap.freeHead = heap.freeTail = 0;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+//////////////////////// (private) METHOD DEFNITION //////////////////
+//////////////////////////////////////////////////////////////////////
+
+template<class T>
+typename PairingHeap<T>::Node* PairingHeap<T>::allocNode(T item){
+    Node* node;
+    if(freeHead != 0){
+        node = freeHead;
+        freeHead = freeHead->next;
+        if(freeHead == 0) freeTail = 0;
+    }
+    else{
+        if(blockUsed == NODES_PER_BLOCK){
+            Block* block = new Block();
+            block->next = 0;
+            if(blockTail == 0) blockHead = block;
+            else blockTail->next = block;
+            blockTail = block;
+            blockUsed = 0;
+        }
+        node = &blockTail->nodes[blockUsed++];
+    }
+    node->data = item;
+    node->child = node->next = node->prev = 0;
+    return node;
+}
+
+template<class T>
+void PairingHeap<T>::releaseNode(Node* node){
+    node->child = node->prev = 0;
+    node->next = 0;
+    if(freeTail == 0) freeHead = node;
+    else freeTail->next = node;
+    freeTail = node;
+}
+
+template<class T>
+typename PairingHeap<T>::Node* PairingHeap<T>::link(Node* a, Node* b){
+    //a, b: roots of two trees (no siblings); return the root of the merged tree
+    if(a == 0) return b;
+    if(b == 0) return a;
+
+    if(aLTb(b->data, a->data)){
+        Node* tmp = a;
+        a = b;
+        b = tmp;
+    }
+    //b becomes the left-most child of a
+    b->prev = a;
+    b->next = a->child;
+    if(a->child != 0) a->child->prev = b;
+    a->child = b;
+    a->next = a->prev = 0;
+    return a;
+}
+
+template<class T>
+typename PairingHeap<T>::Node* PairingHeap<T>::mergePairs(Node* first){
+    if(first == 0) return 0;
+
+    //pass 1: link pairs from left to right, chaining the results backward by "prev"
+    Node* last = 0;
+    Node* cursor = first;
+    while(cursor != 0){
+        Node* a = cursor;
+        Node* b = a->next;
+        cursor = (b != 0) ? b->next : 0;
+        a->next = a->prev = 0;
+        if(b != 0) b->next = b->prev = 0;
+
+        Node* merged = link(a, b);
+        merged->prev = last;
+        last = merged;
+    }
+
+    //pass 2: link from right to left
+    Node* result = last;
+    cursor = last->prev;
+    result->prev = 0;
+    while(cursor != 0){
+        Node* prev = cursor->prev;
+        cursor->prev = 0;
+        result = link(cursor, result);
+        cursor = prev;
+    }
+    return result;
+}
+
+template<class T>
+void PairingHeap<T>::cut(Node* node){
+    //detach node (and its subtree) from its parent/siblings; node != root
+    if(node->prev->child == node) node->prev->child = node->next;
+    else node->prev->next = node->next;
+    if(node->next != 0) node->next->prev = node->prev;
+    node->next = node->prev = 0;
+}
+
+template<class T>
+typename PairingHeap<T>::Node* PairingHeap<T>::findNode(T item){
+    XArrayList<Node*> nodes;
+    collectNodes(nodes);
+    for(int idx=0; idx < nodes.size(); idx++){
+        if(compare(nodes.get(idx)->data, item) == 0) return nodes.get(idx);
+    }
+    return 0;
+}
+
+template<class T>
+void PairingHeap<T>::collectNodes(XArrayList<Node*>& nodes){
+    //pre-order with an explicit stack: sibling chains can be very long
+    if(root == 0) return;
+    XArrayList<Node*> stack;
+    stack.add(root);
+    while(!stack.empty()){
+        Node* node = stack.removeAt(stack.size() - 1);
+        nodes.add(node);
+        if(node->next != 0) stack.add(node->next);
+        if(node->child != 0) stack.add(node->child);
+    }
+}
+
+template<class T>
+void PairingHeap<T>::removeInternalData(){
+    if(this->deleteUserData != 0) deleteUserData(this); //clear users's data if they want
+
+    Block* block = blockHead;
+    while(block != 0){
+        Block* next = block->next;
+        delete block;
+        block = next;
+    }
+    this->root = 0;
+    this->count = 0;
+    this->blockHead = this->blockTail = 0;
+    this->blockUsed = NODES_PER_BLOCK;
+    this->freeHead = this->freeTail = 0;
+}
+
+template<class T>
+void PairingHeap<T>::copyFrom(const PairingHeap<T>& heap){
+    this->comparator = heap.comparator;
+    // SHOULD NOT COPY: deleteUserData => items are shared, delete them only once
+    this->deleteUserData = 0;
+
+    XArrayList<Node*> nodes;
+    const_cast<PairingHeap<T>&>(heap).collectNodes(nodes);
+    for(int idx=0; idx < nodes.size(); idx++) insert(nodes.get(idx)->data);
+}
+
+#endif /* PAIRINGHEAP_H */
@@ -6,13 +6,16 @@
  #define DLINKEDLIST_H
  
  #include "list/IList.h"
+ #include "util/Allocator.h"
  
  #include <sstream>
+ #include <stdexcept>
  #include <iostream>
  #include <type_traits>
+ #include <utility>
  using namespace std;
  
- template <class T>
+ template <class T, class Alloc = MallocAllocator>
  class DLinkedList : public IList<T>
  {
  public:
@@ -21,18 +24,28 @@
      class BWDIterator; // Forward declaration
  
  protected:
-     Node *head; // this node does not contain user's data
-     Node *tail; // this node does not contain user's data
+     Node *head; // this node does not contain user's data (points to headNode, see below)
+     Node *tail; // this node does not contain user's data (points to tailNode, see below)
      int count;
-     bool (*itemEqual)(T &lhs, T &rhs);        // function pointer: test if two items (type: T&) are equal or not
-     void (*deleteUserData)(DLinkedList<T> *); // function pointer: be called to remove items (if they are pointer type)
+     struct FreeNode
+     {
+         FreeNode *next;
+     };
+     FreeNode *freeNodes; // memory of removed nodes, reused by the next add (see newNode)
+     int numFreeNodes;    // nodes in freeNodes (at most MAX_FREE_NODES)
+     Node *cacheNode;     // last node reached by position (nullptr: none), see getPreviousNodeOf
+     int cacheIndex;      // position of cacheNode
+     bool (*itemEqual)(T &lhs, T &rhs);               // function pointer: test if two items (type: T&) are equal or not
+     void (*deleteUserData)(DLinkedList<T, Alloc> *); // function pointer: be called to remove items (if they are pointer type)
  
  public:
      DLinkedList(
-         void (*deleteUserData)(DLinkedList<T> *) = 0,
+         void (*deleteUserData)(DLinkedList<T, Alloc> *) = 0,
          bool (*itemEqual)(T &, T &) = 0);
-     DLinkedList(const DLinkedList<T> &list);
-     DLinkedList<T> &operator=(const DLinkedList<T> &list);
+     DLinkedList(const DLinkedList<T, Alloc> &list);
+     DLinkedList(DLinkedList<T, Alloc> &&list) noexcept; // takes the nodes of "list": no allocation
+     DLinkedList<T, Alloc> &operator=(const DLinkedList<T, Alloc> &list);
+     DLinkedList<T, Alloc> &operator=(DLinkedList<T, Alloc> &&list) noexcept; // same: "list" is left empty
      ~DLinkedList();
  
      // Inherit from IList: BEGIN
@@ -53,15 +66,44 @@
      {
          cout << toString(item2str) << endl;
      }
-     void setDeleteUserDataPtr(void (*deleteUserData)(DLinkedList<T> *) = 0)
+     void setDeleteUserDataPtr(void (*deleteUserData)(DLinkedList<T, Alloc> *) = 0)
      {
          this->deleteUserData = deleteUserData;
      }
+     /* releaseFreeNodes(): give the memory of removed nodes back to Alloc
+      *  (e.g., after clearing a list that will stay small from now on)
+      */
+     void releaseFreeNodes()
+     {
+         while (this->freeNodes != nullptr)
+         {
+             FreeNode *next = this->freeNodes->next;
+             Alloc::deallocate(this->freeNodes, sizeof(Node));
+             this->freeNodes = next;
+         }
+         this->numFreeNodes = 0;
+     }
+ 
+     /*
+      * Moving nodes between lists: the nodes are relinked, never copied nor allocated
+      *  (both lists have the same Alloc, so a node can be freed by either of them)
+      *  + splice(position, other): all the items of "other" are inserted before index
+      *      "position" of this list; "other" becomes empty
+      *  + splice(position, other, from, to): same, for the items [from, to) of "other" only
+      *  + splitAt(index): the items [index, size()) are moved to a new list (returned);
+      *      this list keeps [0, index)
+      *  + concat(other): all the items of "other" are moved to the end of this list: O(1)
+      *  Cost: finding "position", "from" and "to" (see getPreviousNodeOf); O(1) at either end.
+      */
+     void splice(int position, DLinkedList<T, Alloc> &other);
+     void splice(int position, DLinkedList<T, Alloc> &other, int from, int to);
+     DLinkedList<T, Alloc> splitAt(int index);
+     void concat(DLinkedList<T, Alloc> &&other);
  
      bool contains(T array[], int size)
      {
          int idx = 0;
-         for (DLinkedList<T>::Iterator it = begin(); it != end(); it++)
+         for (DLinkedList<T, Alloc>::Iterator it = begin(); it != end(); it++)
          {
              if (!equals(*it, array[idx++], this->itemEqual))
                  return false;
@@ -77,9 +119,9 @@
       *      Example:
       *      DLinkedList<T> list(&DLinkedList<T>::free);
       */
-     static void free(DLinkedList<T> *list)
+     static void free(DLinkedList<T, Alloc> *list)
      {
-         typename DLinkedList<T>::Iterator it = list->begin();
+         typename DLinkedList<T, Alloc>::Iterator it = list->begin();
          while (it != list->end())
          {
              delete *it;
@@ -131,9 +173,66 @@
          else
              return itemEqual(lhs, rhs);
      }
-     void copyFrom(const DLinkedList<T> &list);
+     void copyFrom(const DLinkedList<T, Alloc> &list);
      void removeInternalData();
      Node *getPreviousNodeOf(int index);
+
+     void initSentinels();
+     // unlink the nodes [from, to) (a chain first..last), link a chain of n nodes before "position"
+     void detachRange(int from, int to, Node *&first, Node *&last);
+     void attachRange(int position, Node *first, Node *last, int n);
+
+     /* newNode, deleteNode: nodes come from Alloc (see util/Allocator.h) and are recycled:
+      *  + deleteNode destroys the node and keeps its memory in "freeNodes",
+      *      up to MAX_FREE_NODES nodes; beyond that, the memory goes back to Alloc
+      *  + newNode takes memory from "freeNodes" first
+      *  so a list that keeps adding and removing reaches a steady state with no
+      *  allocation at all, while clearing a large list does not keep its peak
+      *  memory; the rest goes back to Alloc in the destructor (or with releaseFreeNodes)
+      */
+     static const int MAX_FREE_NODES = 64;
+
+     template <class... Args>
+     Node *newNode(Args &&...args)
+     {
+         void *memory;
+         if (this->freeNodes != nullptr)
+         {
+             memory = this->freeNodes;
+             this->freeNodes = this->freeNodes->next;
+             this->numFreeNodes--;
+         }
+         else
+         {
+             memory = Alloc::allocate(sizeof(Node));
+         }
+         try
+         {
+             return new (memory) Node(std::forward<Args>(args)...);
+         }
+         catch (...)
+         {
+             pushFree(memory);
+             throw;
+         }
+     }
+     void deleteNode(Node *pNode)
+     {
+         pNode->~Node();
+         pushFree(pNode);
+     }
+     void pushFree(void *memory)
+     {
+         if (this->numFreeNodes == MAX_FREE_NODES)
+         {
+             Alloc::deallocate(memory, sizeof(Node));
+             return;
+         }
+         FreeNode *pFree = new (memory) FreeNode;
+         pFree->next = this->freeNodes;
+         this->freeNodes = pFree;
+         this->numFreeNodes++;
+     }
  
      //////////////////////////////////////////////////////////////////////
      ////////////////////////  INNER CLASSES DEFNITION ////////////////////
@@ -145,7 +244,7 @@
          T data;
          Node *next;
          Node *prev;
-         friend class DLinkedList<T>;
+         friend class DLinkedList<T, Alloc>;
  
      public:
          Node(Node *next = 0, Node *prev = 0)
@@ -153,9 +252,8 @@
              this->next = next;
              this->prev = prev;
          }
-         Node(T data, Node *next = 0, Node *prev = 0)
+         Node(T data, Node *next = 0, Node *prev = 0) : data(std::move(data))
          {
-             this->data = data;
              this->next = next;
              this->prev = prev;
          }
@@ -165,11 +263,11 @@
      class Iterator
      {
      private:
-         DLinkedList<T> *pList;
+         DLinkedList<T, Alloc> *pList;
          Node *pNode;
  
      public:
-         Iterator(DLinkedList<T> *pList = 0, bool begin = true)
+         Iterator(DLinkedList<T, Alloc> *pList = 0, bool begin = true)
          {
              if (begin)
              {
@@ -201,9 +299,10 @@
              Node *pNext = pNode->prev; // MUST prev, so iterator++ will go to end
              if (removeItemData != 0)
                  removeItemData(pNode->data);
-             delete pNode;
+             pList->deleteNode(pNode);
              pNode = pNext;
              pList->count -= 1;
+             pList->cacheNode = nullptr;
          }
  
          T &operator*()
@@ -232,11 +331,11 @@
      class BWDIterator
      {
      private:
-         DLinkedList<T> *pList;
+         DLinkedList<T, Alloc> *pList;
          Node *pNode;
  
      public:
-     BWDIterator(DLinkedList<T> *pList = 0, bool last = true)
+     BWDIterator(DLinkedList<T, Alloc> *pList = 0, bool last = true)
      {
          if (last)
          {
@@ -268,9 +367,10 @@
          Node *pNext = pNode->next; // MUST next, so iterator-- will go to head
          if (removeItemData != 0)
              removeItemData(pNode->data);
-         delete pNode;
+         pList->deleteNode(pNode);
          pNode = pNext;
          pList->count -= 1;
+         pList->cacheNode = nullptr;
      }
 
      T &operator*()
@@ -295,48 +395,53 @@
          return iterator;
      }
      };
+
+ protected:
+     // the sentinels live inside the list object: creating a list allocates nothing
+     Node headNode;
+     Node tailNode;
  };
  
  //////////////////////////////////////////////////////////////////////
  // Define a shorter name for DLinkedList:
  
- template <class T>
- using List = DLinkedList<T>;
+ template <class T, class Alloc = MallocAllocator>
+ using List = DLinkedList<T, Alloc>;
  
  //////////////////////////////////////////////////////////////////////
  ////////////////////////     METHOD DEFNITION      ///////////////////
  //////////////////////////////////////////////////////////////////////
  
- template <class T>
- DLinkedList<T>::DLinkedList(
-     void (*deleteUserData)(DLinkedList<T> *),
+ template <class T, class Alloc>
+ DLinkedList<T, Alloc>::DLinkedList(
+     void (*deleteUserData)(DLinkedList<T, Alloc> *),
      bool (*itemEqual)(T &, T &))
  {
      // TODO
-     this->head = new Node();
-     this->tail = new Node();
-     this->head->next = this->tail;
-     this->tail->prev = this->head;
-     this->head->prev = this->tail->next = nullptr; // just to be for sure
-     this->count = 0;
+     initSentinels();
      this->deleteUserData = deleteUserData;
      this->itemEqual = itemEqual;
  }
  
- template <class T>
- DLinkedList<T>::DLinkedList(const DLinkedList<T> &list)
+ template <class T, class Alloc>
+ DLinkedList<T, Alloc>::DLinkedList(const DLinkedList<T, Alloc> &list)
  {
      // TODO
-     this->head = new Node();
-     this->tail = new Node();
-     this->head->next = this->tail;
-     this->tail->prev = this->head;
-     this->head->prev = this->tail->next = nullptr; 
+     initSentinels();
      copyFrom(list);
  }
  
- template <class T>
- DLinkedList<T> &DLinkedList<T>::operator=(const DLinkedList<T> &list)
+ template <class T, class Alloc>
+ DLinkedList<T, Alloc>::DLinkedList(DLinkedList<T, Alloc> &&list) noexcept
+ {
+     initSentinels();
+     this->deleteUserData = list.deleteUserData;
+     this->itemEqual = list.itemEqual;
+     concat(std::move(list));
+ }
+ 
+ template <class T, class Alloc>
+ DLinkedList<T, Alloc> &DLinkedList<T, Alloc>::operator=(const DLinkedList<T, Alloc> &list)
  {
      // TODO
      if (this != &list) {
@@ -347,33 +452,41 @@
      return *this;
  }
  
- template <class T>
- DLinkedList<T>::~DLinkedList()
+ template <class T, class Alloc>
+ DLinkedList<T, Alloc> &DLinkedList<T, Alloc>::operator=(DLinkedList<T, Alloc> &&list) noexcept
+ {
+     if (this != &list) {
+         // release our nodes, then relink the nodes of "list" between our sentinels
+         clear();
+         this->deleteUserData = list.deleteUserData;
+         this->itemEqual = list.itemEqual;
+         concat(std::move(list));
+     }
+     return *this;
+ }
+ 
+ template <class T, class Alloc>
+ DLinkedList<T, Alloc>::~DLinkedList()
  {
      // TODO
      // remove all nodes and user-defined data first 
-     // then remove dummy head and tail
+     // then give their memory back (dummy head and tail are members)
      removeInternalData();
-     if (this->head != nullptr) {
-         delete this->head;
-     }
-     if (this->tail != nullptr) {
-         delete this->tail;
-     }
+     releaseFreeNodes();
  }
  
- template <class T>
- void DLinkedList<T>::add(T e)
+ template <class T, class Alloc>
+ void DLinkedList<T, Alloc>::add(T e)
  {
      // TODO
-     Node *newNode = new Node(e, this->tail, this->tail->prev);
+     Node *pNew = newNode(e, this->tail, this->tail->prev);
  
-     this->tail->prev->next = newNode;
-     this->tail->prev = newNode;
+     this->tail->prev->next = pNew;
+     this->tail->prev = pNew;
      this->count++;
  }
- template <class T>
- void DLinkedList<T>::add(int index, T e)
+ template <class T, class Alloc>
+ void DLinkedList<T, Alloc>::add(int index, T e)
  {
      // TODO
      if (index < 0 || index > this->count) {
@@ -386,24 +499,28 @@
          return;
      }
  
-     Node *newNode = new Node(e);
+     Node *pNew = newNode(e);
      Node *prevNode =  (index == 0) ? this->head : getPreviousNodeOf(index);
      
-     newNode->next = prevNode->next;
-     newNode->prev = prevNode;
-     prevNode->next->prev = newNode;
-     prevNode->next = newNode;
+     pNew->next = prevNode->next;
+     pNew->prev = prevNode;
+     prevNode->next->prev = pNew;
+     prevNode->next = pNew;
+     if (this->cacheNode != nullptr && this->cacheIndex >= index) {
+         this->cacheIndex++;
+     }
  
      this->count++;
  }
  
- template <class T>
- typename DLinkedList<T>::Node *DLinkedList<T>::getPreviousNodeOf(int index)
+ template <class T, class Alloc>
+ typename DLinkedList<T, Alloc>::Node *DLinkedList<T, Alloc>::getPreviousNodeOf(int index)
  {
      /**
       * Returns the node preceding the specified index in the doubly linked list.
-      * If the index is in the first half of the list, it traverses from the head; otherwise, it traverses from the tail.
-      * Efficiently navigates to the node by choosing the shorter path based on the index's position.
+      * The walk starts from the nearest of: head, tail and the node reached by the
+      * previous positional access (cacheNode), so scanning the list by index
+      * (get(0), get(1), ...) costs O(1) per step instead of O(n).
       */
      // TODO
      if (index < 0 || index >= this->count) {
@@ -415,26 +532,39 @@
          return this->head;
      }
  
-     Node *tmp = nullptr;
-     if (index <= this->count / 2) {
-         // traverse from head to index - 1
-         tmp = this->head->next;
-         for (int i = 0; i < index - 1; i++) {
-             tmp = tmp->next;
-         }
-     } else {
-         // traverse from tail to index - 1
-         tmp = this->tail->prev;
-         for (int i = this->count; i > index; i--) {
-             tmp = tmp->prev;
+     int target = index - 1;
+     // position -1 is head, position count is tail
+     Node *tmp = this->head;
+     int position = -1;
+     if (this->count - target < target - position) {
+         tmp = this->tail;
+         position = this->count;
+     }
+     if (this->cacheNode != nullptr) {
+         int distance = (this->cacheIndex > target) ? this->cacheIndex - target : target - this->cacheIndex;
+         int best = (position > target) ? position - target : target - position;
+         if (distance < best) {
+             tmp = this->cacheNode;
+             position = this->cacheIndex;
          }
      }
+     while (position < target) {
+         tmp = tmp->next;
+         position++;
+     }
+     while (position > target) {
+         tmp = tmp->prev;
+         position--;
+     }
  
+     this->cacheNode = tmp;
+     this->cacheIndex = target;
      return tmp;
  }
+
  
- template <class T>
- T DLinkedList<T>::removeAt(int index)
+ template <class T, class Alloc>
+ T DLinkedList<T, Alloc>::removeAt(int index)
  {
      // TODO
      if (index < 0 || index >= this->count) {
@@ -443,33 +573,38 @@
  
      Node *prevNode = getPreviousNodeOf(index);
      Node *tmp = prevNode->next;
-     T data = tmp->data;
+     T data = std::move(tmp->data);
  
      prevNode->next = tmp->next;
      tmp->next->prev = prevNode;
-     delete tmp;
+     deleteNode(tmp);
+     if (this->cacheNode != nullptr && this->cacheIndex >= index) {
+         // the removed node may be the cached one: fall back on its predecessor
+         this->cacheNode = (index == 0) ? nullptr : prevNode;
+         this->cacheIndex = index - 1;
+     }
  
      this->count--;
  
      return data;
  }
  
- template <class T>
- bool DLinkedList<T>::empty()
+ template <class T, class Alloc>
+ bool DLinkedList<T, Alloc>::empty()
  {
      // TODO
      return this->count == 0;
  }
  
- template <class T>
- int DLinkedList<T>::size()
+ template <class T, class Alloc>
+ int DLinkedList<T, Alloc>::size()
  {
      // TODO
      return this->count;
  }
  
- template <class T>
- void DLinkedList<T>::clear()
+ template <class T, class Alloc>
+ void DLinkedList<T, Alloc>::clear()
  {
      // TODO
      removeInternalData();
@@ -479,8 +614,8 @@
      this->head->prev = this->tail->next = nullptr; // just to be for sure
  }
  
- template <class T>
- T &DLinkedList<T>::get(int index)
+ template <class T, class Alloc>
+ T &DLinkedList<T, Alloc>::get(int index)
  {
      // TODO
      if (index < 0 || index >= this->count) {
@@ -491,8 +626,8 @@
      return tmp->next->data;
  }
  
- template <class T>
- int DLinkedList<T>::indexOf(T item)
+ template <class T, class Alloc>
+ int DLinkedList<T, Alloc>::indexOf(T item)
  {
      // TODO
      Node *tmp = this->head->next;
@@ -507,8 +642,8 @@
      return -1;
  }
  
- template <class T>
- bool DLinkedList<T>::removeItem(T item, void (*removeItemData)(T))
+ template <class T, class Alloc>
+ bool DLinkedList<T, Alloc>::removeItem(T item, void (*removeItemData)(T))
  {
      // TODO
      int index = indexOf(item);
@@ -526,15 +661,15 @@
      return true;
  }
  
- template <class T>
- bool DLinkedList<T>::contains(T item)
+ template <class T, class Alloc>
+ bool DLinkedList<T, Alloc>::contains(T item)
  {
      // TODO
      return indexOf(item) != -1;
  }
  
- template <class T>
- string DLinkedList<T>::toString(string (*item2str)(T &))
+ template <class T, class Alloc>
+ string DLinkedList<T, Alloc>::toString(string (*item2str)(T &))
  {
      /**
       * Converts the list into a string representation, where each element is formatted using a user-provided function.
@@ -573,8 +708,55 @@
      return ss.str();
  }
  
- template <class T>
- void DLinkedList<T>::copyFrom(const DLinkedList<T> &list)
+ template <class T, class Alloc>
+ void DLinkedList<T, Alloc>::splice(int position, DLinkedList<T, Alloc> &other)
+ {
+     splice(position, other, 0, other.count);
+ }
+ 
+ template <class T, class Alloc>
+ void DLinkedList<T, Alloc>::splice(int position, DLinkedList<T, Alloc> &other, int from, int to)
+ {
+     if (position < 0 || position > this->count) {
+         throw std::out_of_range("Index is out of range!");
+     }
+     if (from < 0 || to > other.count || from > to) {
+         throw std::out_of_range("Index is out of range!");
+     }
+     if (&other == this) {
+         throw std::invalid_argument("DLinkedList::splice: other must be another list");
+     }
+     if (from == to) {
+         return;
+     }
+ 
+     Node *first, *last;
+     other.detachRange(from, to, first, last);
+     attachRange(position, first, last, to - from);
+ }
+ 
+ template <class T, class Alloc>
+ DLinkedList<T, Alloc> DLinkedList<T, Alloc>::splitAt(int index)
+ {
+     if (index < 0 || index > this->count) {
+         throw std::out_of_range("Index is out of range!");
+     }
+     DLinkedList<T, Alloc> rest(this->deleteUserData, this->itemEqual);
+     rest.splice(0, *this, index, this->count);
+     return rest;
+ }
+ 
+ template <class T, class Alloc>
+ void DLinkedList<T, Alloc>::concat(DLinkedList<T, Alloc> &&other)
+ {
+     if (&other == this) {
+         return;
+     }
+     splice(this->count, other, 0, other.count);
+ }
+ 
+ template <class T, class Alloc>
+ void DLinkedList<T, Alloc>::copyFrom(const DLinkedList<T, Alloc> &list)
  {
      /**
       * Copies the contents of another doubly linked list into this list.
@@ -600,8 +782,55 @@
      }
  }
  
- template <class T>
- void DLinkedList<T>::removeInternalData()
+ template <class T, class Alloc>
+ void DLinkedList<T, Alloc>::initSentinels()
+ {
+     this->head = &this->headNode;
+     this->tail = &this->tailNode;
+     this->head->next = this->tail;
+     this->tail->prev = this->head;
+     this->head->prev = this->tail->next = nullptr; // just to be for sure
+     this->count = 0;
+     this->freeNodes = nullptr;
+     this->numFreeNodes = 0;
+     this->cacheNode = nullptr;
+     this->cacheIndex = -1;
+ }
+
+ template <class T, class Alloc>
+ void DLinkedList<T, Alloc>::detachRange(int from, int to, Node *&first, Node *&last)
+ {
+     Node *prevNode = getPreviousNodeOf(from);
+     last = (to == this->count) ? this->tail->prev : getPreviousNodeOf(to);
+     first = prevNode->next;
+ 
+     prevNode->next = last->next;
+     last->next->prev = prevNode;
+     first->prev = last->next = nullptr;
+     this->count -= to - from;
+     this->cacheNode = nullptr;
+ }
+ 
+ template <class T, class Alloc>
+ void DLinkedList<T, Alloc>::attachRange(int position, Node *first, Node *last, int n)
+ {
+     Node *prevNode;
+     if (position == this->count) {
+         prevNode = this->tail->prev;
+     } else {
+         prevNode = (position == 0) ? this->head : getPreviousNodeOf(position);
+     }
+ 
+     first->prev = prevNode;
+     last->next = prevNode->next;
+     prevNode->next->prev = last;
+     prevNode->next = first;
+     this->count += n;
+     this->cacheNode = nullptr;
+ }
+ 
+ template <class T, class Alloc>
+ void DLinkedList<T, Alloc>::removeInternalData()
  {
      /**
       * Clears the internal data of the list by deleting all nodes and user-defined data.
@@ -619,10 +848,11 @@
          Node *tmp = this->head->next;
          while (tmp != this->tail) {
              Node *next = tmp->next;
-             delete tmp;
+             deleteNode(tmp);
              tmp = next;
          }
      }
+     this->cacheNode = nullptr;
  }
  
  #endif /* DLINKEDLIST_H */
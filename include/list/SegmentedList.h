@@ -0,0 +1,469 @@
+/*
+ * File:   SegmentedList.h
+ */
+
+#ifndef SEGMENTEDLIST_H
+#define SEGMENTEDLIST_H
+#include "list/IList.h"
+#include "util/MemLib.h"
+#include <sstream>
+#include <iostream>
+#include <stdexcept>
+using namespace std;
+
+/*
+ * SegmentedList<T, chunkBits>: an array list stored in chunks of (1 << chunkBits) items.
+ *  + directory: array of pointers to the chunks; item i is chunks[i >> chunkBits][i & mask]
+ *  + growing adds a chunk (and, rarely, doubles the directory, which holds pointers only):
+ *      existing items are NEVER copied or moved, so get(i) references stay valid
+ *      while items are appended (add(e)); at most one chunk of spare memory
+ *  + get(i) is O(1); add(index, e) and removeAt(index) shift the items after index
+ *  For example:
+ *      SegmentedList<LogEntry> log;      // chunks of 1024 entries
+ *      LogEntry& first = log.get(0);     // still valid after millions of log.add(...)
+ */
+template <class T, int chunkBits = 10>
+class SegmentedList : public IList<T>
+{
+    static_assert(chunkBits > 0 && chunkBits < 30, "SegmentedList: chunkBits must be in [1, 29]");
+
+public:
+    class Iterator; // forward declaration
+    static const int CHUNK_SIZE = 1 << chunkBits;
+
+protected:
+    T **chunks;                                          // directory: chunks[0..numChunks-1] are allocated (see util/MemLib.h)
+    int numChunks;                                       // number of allocated chunks
+    int directoryCapacity;                               // size of the directory array
+    int count;                                           // number of items: only items [0, count) are constructed
+    bool (*itemEqual)(T &lhs, T &rhs);                   // function pointer: test if two items (type: T&) are equal or not
+    void (*deleteUserData)(SegmentedList<T, chunkBits> *); // function pointer: be called to remove items (if they are pointer type)
+
+public:
+    SegmentedList(
+        void (*deleteUserData)(SegmentedList<T, chunkBits> *) = 0,
+        bool (*itemEqual)(T &, T &) = 0);
+    SegmentedList(const SegmentedList<T, chunkBits> &list);
+    SegmentedList<T, chunkBits> &operator=(const SegmentedList<T, chunkBits> &list);
+    ~SegmentedList();
+
+    // Inherit from IList: BEGIN
+    void add(T e);
+    void add(int index, T e);
+    T removeAt(int index);
+    bool removeItem(T item, void (*removeItemData)(T) = 0);
+    bool empty();
+    int size();
+    void clear();
+    T &get(int index);
+    int indexOf(T item);
+    bool contains(T item);
+    string toString(string (*item2str)(T &) = 0);
+    // Inherit from IList: END
+
+    void println(string (*item2str)(T &) = 0)
+    {
+        cout << toString(item2str) << endl;
+    }
+    void setDeleteUserDataPtr(void (*deleteUserData)(SegmentedList<T, chunkBits> *) = 0)
+    {
+        this->deleteUserData = deleteUserData;
+    }
+    /* chunkCount(): number of allocated chunks
+     */
+    int chunkCount()
+    {
+        return this->numChunks;
+    }
+
+    Iterator begin()
+    {
+        return Iterator(this, 0);
+    }
+    Iterator end()
+    {
+        return Iterator(this, count);
+    }
+
+    /** free:
+     * if T is pointer type:
+     *     pass THE address of method "free" to SegmentedList<T>'s constructor
+     * Example:
+     *  SegmentedList<Point*> list(&SegmentedList<Point*>::free);
+     */
+    static void free(SegmentedList<T, chunkBits> *list)
+    {
+        for (int i = 0; i < list->count; i++)
+            delete list->at(i);
+    }
+
+protected:
+    T &at(int index)
+    {
+        return this->chunks[index >> chunkBits][index & (CHUNK_SIZE - 1)];
+    }
+    T *slot(int index)
+    {
+        return &this->chunks[index >> chunkBits][index & (CHUNK_SIZE - 1)];
+    }
+    void checkIndex(int index);     // check validity of index for accessing
+    void ensureCapacity(int index); // add chunks (never moves the items) if needed
+    void releaseSpareChunks();      // keep at most one empty chunk after the last item
+
+    static bool equals(T &lhs, T &rhs, bool (*itemEqual)(T &, T &))
+    {
+        if (itemEqual == 0)
+            return lhs == rhs;
+        else
+            return itemEqual(lhs, rhs);
+    }
+
+    void copyFrom(const SegmentedList<T, chunkBits> &list);
+    void removeInternalData();
+
+    //////////////////////////////////////////////////////////////////////
+    ////////////////////////  INNER CLASSES DEFNITION ////////////////////
+    //////////////////////////////////////////////////////////////////////
+public:
+    // Iterator: BEGIN
+    class Iterator
+    {
+    private:
+        int cursor;
+        SegmentedList<T, chunkBits> *pList;
+
+    public:
+        Iterator(SegmentedList<T, chunkBits> *pList = 0, int index = 0)
+        {
+            this->pList = pList;
+            this->cursor = index;
+        }
+        Iterator(const Iterator &iterator)
+        {
+            cursor = iterator.cursor;
+            pList = iterator.pList;
+        }
+        Iterator &operator=(const Iterator &iterator)
+        {
+            cursor = iterator.cursor;
+            pList = iterator.pList;
+            return *this;
+        }
+        void remove(void (*removeItemData)(T) = 0)
+        {
+            T item = pList->removeAt(cursor);
+            if (removeItemData != 0)
+                removeItemData(item);
+            cursor -= 1; // MUST keep index of previous, for ++ later
+        }
+
+        T &operator*()
+        {
+            return pList->at(cursor);
+        }
+        bool operator!=(const Iterator &iterator)
+        {
+            return cursor != iterator.cursor;
+        }
+        // Prefix ++ overload
+        Iterator &operator++()
+        {
+            this->cursor++;
+            return *this;
+        }
+        // Postfix ++ overload
+        Iterator operator++(int)
+        {
+            Iterator iterator = *this;
+            ++*this;
+            return iterator;
+        }
+    };
+    // Iterator: END
+};
+
+//////////////////////////////////////////////////////////////////////
+////////////////////////     METHOD DEFNITION      ///////////////////
+//////////////////////////////////////////////////////////////////////
+
+template <class T, int chunkBits>
+SegmentedList<T, chunkBits>::SegmentedList(
+    void (*deleteUserData)(SegmentedList<T, chunkBits> *),
+    bool (*itemEqual)(T &, T &))
+{
+    this->deleteUserData = deleteUserData;
+    this->itemEqual = itemEqual;
+    this->chunks = nullptr;
+    this->numChunks = 0;
+    this->directoryCapacity = 0;
+    this->count = 0;
+}
+
+template <class T, int chunkBits>
+void SegmentedList<T, chunkBits>::copyFrom(const SegmentedList<T, chunkBits> &list)
+{
+    this->chunks = nullptr;
+    this->numChunks = 0;
+    this->directoryCapacity = 0;
+    this->count = 0;
+    this->deleteUserData = list.deleteUserData;
+    this->itemEqual = list.itemEqual;
+
+    SegmentedList<T, chunkBits> *pSource = const_cast<SegmentedList<T, chunkBits> *>(&list);
+    ensureCapacity(list.count);
+    for (int i = 0; i < list.count; i++)
+    {
+        new (slot(i)) T(pSource->at(i));
+        this->count++;
+    }
+}
+
+template <class T, int chunkBits>
+void SegmentedList<T, chunkBits>::removeInternalData()
+{
+    if (deleteUserData != nullptr)
+    {
+        deleteUserData(this);
+    }
+    for (int c = 0; c < this->numChunks; c++)
+    {
+        long long used = (long long)this->count - (long long)c * CHUNK_SIZE;
+        destroyRange(this->chunks[c], 0, (used < CHUNK_SIZE) ? ((used > 0) ? (int)used : 0) : CHUNK_SIZE);
+        freeRaw(this->chunks[c], CHUNK_SIZE);
+    }
+    delete[] this->chunks;
+    this->chunks = nullptr;
+    this->numChunks = 0;
+    this->directoryCapacity = 0;
+    this->count = 0;
+}
+
+template <class T, int chunkBits>
+SegmentedList<T, chunkBits>::SegmentedList(const SegmentedList<T, chunkBits> &list)
+{
+    copyFrom(list);
+}
+
+template <class T, int chunkBits>
+SegmentedList<T, chunkBits> &SegmentedList<T, chunkBits>::operator=(const SegmentedList<T, chunkBits> &list)
+{
+    if (this != &list)
+    {
+        removeInternalData();
+        copyFrom(list);
+    }
+    return *this;
+}
+
+template <class T, int chunkBits>
+SegmentedList<T, chunkBits>::~SegmentedList()
+{
+    removeInternalData();
+}
+
+template <class T, int chunkBits>
+void SegmentedList<T, chunkBits>::add(T e)
+{
+    ensureCapacity(this->count + 1);
+    new (slot(this->count)) T(std::move(e));
+    this->count++;
+}
+
+template <class T, int chunkBits>
+void SegmentedList<T, chunkBits>::add(int index, T e)
+{
+    if (index < 0 || index > this->count)
+    {
+        throw out_of_range("Index is out of range!");
+    }
+    if (index == this->count)
+    {
+        add(e);
+        return;
+    }
+
+    ensureCapacity(this->count + 1);
+
+    // the slot at count is raw memory: construct it, then shift the rest
+    new (slot(this->count)) T(std::move(at(this->count - 1)));
+    for (int i = this->count - 1; i > index; i--)
+    {
+        at(i) = std::move(at(i - 1));
+    }
+    at(index) = std::move(e);
+    this->count++;
+}
+
+template <class T, int chunkBits>
+T SegmentedList<T, chunkBits>::removeAt(int index)
+{
+    checkIndex(index);
+    T item = std::move(at(index));
+
+    for (int i = index; i < this->count - 1; ++i)
+    {
+        at(i) = std::move(at(i + 1));
+    }
+    destroyRange(slot(this->count - 1), 0, 1);
+    this->count--;
+    releaseSpareChunks();
+    return item;
+}
+
+template <class T, int chunkBits>
+bool SegmentedList<T, chunkBits>::removeItem(T item, void (*removeItemData)(T))
+{
+    for (int i = 0; i < this->count; i++)
+    {
+        if (equals(at(i), item, this->itemEqual))
+        {
+            if (removeItemData != nullptr)
+            {
+                removeItemData(at(i));
+            }
+            removeAt(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+template <class T, int chunkBits>
+bool SegmentedList<T, chunkBits>::empty()
+{
+    return this->count == 0;
+}
+
+template <class T, int chunkBits>
+int SegmentedList<T, chunkBits>::size()
+{
+    return this->count;
+}
+
+template <class T, int chunkBits>
+void SegmentedList<T, chunkBits>::clear()
+{
+    if (deleteUserData != nullptr)
+    {
+        deleteUserData(this);
+    }
+    for (int c = 0; (long long)c * CHUNK_SIZE < this->count; c++)
+    {
+        long long used = (long long)this->count - (long long)c * CHUNK_SIZE;
+        destroyRange(this->chunks[c], 0, (used < CHUNK_SIZE) ? (int)used : CHUNK_SIZE);
+    }
+    this->count = 0;
+    releaseSpareChunks();
+}
+
+template <class T, int chunkBits>
+T &SegmentedList<T, chunkBits>::get(int index)
+{
+    checkIndex(index);
+    return at(index);
+}
+
+template <class T, int chunkBits>
+int SegmentedList<T, chunkBits>::indexOf(T item)
+{
+    for (int i = 0; i < this->count; i++)
+    {
+        if (equals(at(i), item, this->itemEqual))
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+template <class T, int chunkBits>
+bool SegmentedList<T, chunkBits>::contains(T item)
+{
+    return indexOf(item) != -1;
+}
+
+template <class T, int chunkBits>
+string SegmentedList<T, chunkBits>::toString(string (*item2str)(T &))
+{
+    stringstream ss;
+    ss << "[";
+    for (int i = 0; i < this->count; ++i)
+    {
+        if (i > 0)
+        {
+            ss << ", ";
+        }
+        if (item2str)
+        {
+            ss << item2str(at(i));
+        }
+        else
+        {
+            ss << at(i);
+        }
+    }
+    ss << "]";
+    return ss.str();
+}
+
+//////////////////////////////////////////////////////////////////////
+//////////////////////// (private) METHOD DEFNITION //////////////////
+//////////////////////////////////////////////////////////////////////
+template <class T, int chunkBits>
+void SegmentedList<T, chunkBits>::checkIndex(int index)
+{
+    if (index < 0 || index >= this->count)
+    {
+        throw out_of_range("Index is out of range!");
+    }
+}
+
+template <class T, int chunkBits>
+void SegmentedList<T, chunkBits>::ensureCapacity(int index)
+{
+    // index: number of items that must fit
+    int needed = (int)(((long long)index + CHUNK_SIZE - 1) >> chunkBits);
+    if (needed <= this->numChunks)
+    {
+        return;
+    }
+
+    if (needed > this->directoryCapacity)
+    {
+        // only the chunk pointers are copied
+        int newCapacity = (this->directoryCapacity > 0) ? this->directoryCapacity : 4;
+        while (newCapacity < needed)
+        {
+            newCapacity *= 2;
+        }
+        T **newChunks = new T *[newCapacity];
+        for (int c = 0; c < this->numChunks; c++)
+        {
+            newChunks[c] = this->chunks[c];
+        }
+        delete[] this->chunks;
+        this->chunks = newChunks;
+        this->directoryCapacity = newCapacity;
+    }
+
+    while (this->numChunks < needed)
+    {
+        this->chunks[this->numChunks] = allocRaw<T>(CHUNK_SIZE);
+        this->numChunks++;
+    }
+}
+
+template <class T, int chunkBits>
+void SegmentedList<T, chunkBits>::releaseSpareChunks()
+{
+    // chunks after the one holding the last item are empty: keep one of them
+    // so that add/remove around a chunk boundary does not allocate every time
+    int used = (int)(((long long)this->count + CHUNK_SIZE - 1) >> chunkBits);
+    while (this->numChunks > used + 1)
+    {
+        this->numChunks--;
+        freeRaw(this->chunks[this->numChunks], CHUNK_SIZE);
+    }
+}
+
+#endif /* SEGMENTEDLIST_H */
@@ -0,0 +1,438 @@
+/*
+ * File:   SmallXArrayList.h
+ */
+
+#ifndef SMALLXARRAYLIST_H
+#define SMALLXARRAYLIST_H
+#include "list/IList.h"
+#include "util/MemLib.h"
+#include <sstream>
+#include <iostream>
+#include <stdexcept>
+using namespace std;
+
+/*
+ * SmallXArrayList<T, N>: same as XArrayList<T>, but the first N items are stored
+ *  inside the object itself; the heap is used only when the list grows past N.
+ *  For example:
+ *      SmallXArrayList<HuffmanNode*, 4> children; // no malloc for up to 4 children
+ */
+template <class T, int N>
+class SmallXArrayList : public IList<T>
+{
+    static_assert(N > 0, "SmallXArrayList needs room for at least one inline item");
+
+public:
+    class Iterator; // forward declaration
+
+protected:
+    T *data;                                          // inlineData, or a heap buffer once spilled (see util/MemLib.h)
+    int capacity;                                     // size of the array pointed by data
+    int count;                                        // number of items stored: only data[0..count-1] are constructed
+    alignas(T) unsigned char inlineData[N * sizeof(T)]; // raw memory for the first N items
+    bool (*itemEqual)(T &lhs, T &rhs);                // function pointer: test if two items (type: T&) are equal or not
+    void (*deleteUserData)(SmallXArrayList<T, N> *);  // function pointer: be called to remove items (if they are pointer type)
+
+public:
+    SmallXArrayList(
+        void (*deleteUserData)(SmallXArrayList<T, N> *) = 0,
+        bool (*itemEqual)(T &, T &) = 0);
+    SmallXArrayList(const SmallXArrayList<T, N> &list);
+    SmallXArrayList<T, N> &operator=(const SmallXArrayList<T, N> &list);
+    ~SmallXArrayList();
+
+    // Inherit from IList: BEGIN
+    void add(T e);
+    void add(int index, T e);
+    T removeAt(int index);
+    bool removeItem(T item, void (*removeItemData)(T) = 0);
+    bool empty();
+    int size();
+    void clear();
+    T &get(int index);
+    int indexOf(T item);
+    bool contains(T item);
+    string toString(string (*item2str)(T &) = 0);
+    // Inherit from IList: END
+
+    void println(string (*item2str)(T &) = 0)
+    {
+        cout << toString(item2str) << endl;
+    }
+    void setDeleteUserDataPtr(void (*deleteUserData)(SmallXArrayList<T, N> *) = 0)
+    {
+        this->deleteUserData = deleteUserData;
+    }
+    /* isInline(): true while no heap buffer is used
+     */
+    bool isInline()
+    {
+        return this->data == inlineBuffer();
+    }
+
+    Iterator begin()
+    {
+        return Iterator(this, 0);
+    }
+    Iterator end()
+    {
+        return Iterator(this, count);
+    }
+
+    /** free:
+     * if T is pointer type:
+     *     pass THE address of method "free" to SmallXArrayList<T, N>'s constructor
+     * Example:
+     *  SmallXArrayList<Point*, 4> list(&SmallXArrayList<Point*, 4>::free);
+     */
+    static void free(SmallXArrayList<T, N> *list)
+    {
+        for (int i = 0; i < list->count; i++)
+            delete list->data[i];
+    }
+
+protected:
+    T *inlineBuffer()
+    {
+        return reinterpret_cast<T *>(inlineData);
+    }
+    void checkIndex(int index);     // check validity of index for accessing
+    void ensureCapacity(int index); // spill to (or grow) the heap buffer if needed
+
+    static bool equals(T &lhs, T &rhs, bool (*itemEqual)(T &, T &))
+    {
+        if (itemEqual == 0)
+            return lhs == rhs;
+        else
+            return itemEqual(lhs, rhs);
+    }
+
+    void copyFrom(const SmallXArrayList<T, N> &list);
+    void removeInternalData();
+
+    //////////////////////////////////////////////////////////////////////
+    ////////////////////////  INNER CLASSES DEFNITION ////////////////////
+    //////////////////////////////////////////////////////////////////////
+public:
+    // Iterator: BEGIN
+    class Iterator
+    {
+    private:
+        int cursor;
+        SmallXArrayList<T, N> *pList;
+
+    public:
+        Iterator(SmallXArrayList<T, N> *pList = 0, int index = 0)
+        {
+            this->pList = pList;
+            this->cursor = index;
+        }
+        Iterator(const Iterator &iterator)
+        {
+            cursor = iterator.cursor;
+            pList = iterator.pList;
+        }
+        Iterator &operator=(const Iterator &iterator)
+        {
+            cursor = iterator.cursor;
+            pList = iterator.pList;
+            return *this;
+        }
+        void remove(void (*removeItemData)(T) = 0)
+        {
+            T item = pList->removeAt(cursor);
+            if (removeItemData != 0)
+                removeItemData(item);
+            cursor -= 1; // MUST keep index of previous, for ++ later
+        }
+
+        T &operator*()
+        {
+            return pList->data[cursor];
+        }
+        bool operator!=(const Iterator &iterator)
+        {
+            return cursor != iterator.cursor;
+        }
+        // Prefix ++ overload
+        Iterator &operator++()
+        {
+            this->cursor++;
+            return *this;
+        }
+        // Postfix ++ overload
+        Iterator operator++(int)
+        {
+            Iterator iterator = *this;
+            ++*this;
+            return iterator;
+        }
+    };
+    // Iterator: END
+};
+
+//////////////////////////////////////////////////////////////////////
+////////////////////////     METHOD DEFNITION      ///////////////////
+//////////////////////////////////////////////////////////////////////
+
+template <class T, int N>
+SmallXArrayList<T, N>::SmallXArrayList(
+    void (*deleteUserData)(SmallXArrayList<T, N> *),
+    bool (*itemEqual)(T &, T &))
+{
+    this->deleteUserData = deleteUserData;
+    this->itemEqual = itemEqual;
+    this->data = inlineBuffer();
+    this->capacity = N;
+    this->count = 0;
+}
+
+template <class T, int N>
+void SmallXArrayList<T, N>::copyFrom(const SmallXArrayList<T, N> &list)
+{
+    // never share the other list's buffer: stay inline when the items fit
+    this->count = 0;
+    if (list.count <= N)
+    {
+        this->data = inlineBuffer();
+        this->capacity = N;
+    }
+    else
+    {
+        this->data = allocRaw<T>(list.count);
+        this->capacity = list.count;
+    }
+    for (int i = 0; i < list.count; i++)
+    {
+        new (&this->data[i]) T(list.data[i]);
+    }
+    this->count = list.count;
+
+    this->deleteUserData = list.deleteUserData;
+    this->itemEqual = list.itemEqual;
+}
+
+template <class T, int N>
+void SmallXArrayList<T, N>::removeInternalData()
+{
+    if (deleteUserData != nullptr)
+    {
+        deleteUserData(this);
+    }
+    destroyRange(this->data, 0, this->count);
+    if (!isInline())
+    {
+        freeRaw(this->data, this->capacity);
+    }
+    this->data = inlineBuffer();
+    this->capacity = N;
+    this->count = 0;
+}
+
+template <class T, int N>
+SmallXArrayList<T, N>::SmallXArrayList(const SmallXArrayList<T, N> &list)
+{
+    copyFrom(list);
+}
+
+template <class T, int N>
+SmallXArrayList<T, N> &SmallXArrayList<T, N>::operator=(const SmallXArrayList<T, N> &list)
+{
+    if (this != &list)
+    {
+        removeInternalData();
+        copyFrom(list);
+    }
+    return *this;
+}
+
+template <class T, int N>
+SmallXArrayList<T, N>::~SmallXArrayList()
+{
+    removeInternalData();
+}
+
+template <class T, int N>
+void SmallXArrayList<T, N>::add(T e)
+{
+    ensureCapacity(this->count + 1);
+    new (&this->data[this->count]) T(std::move(e));
+    this->count++;
+}
+
+template <class T, int N>
+void SmallXArrayList<T, N>::add(int index, T e)
+{
+    if (index < 0 || index > this->count)
+    {
+        throw out_of_range("Index is out of range!");
+    }
+    if (index == this->count)
+    {
+        add(e);
+        return;
+    }
+
+    ensureCapacity(this->count + 1);
+
+    new (&this->data[this->count]) T(std::move(this->data[this->count - 1]));
+    for (int i = this->count - 1; i > index; i--)
+    {
+        this->data[i] = std::move(this->data[i - 1]);
+    }
+    this->data[index] = std::move(e);
+    this->count++;
+}
+
+template <class T, int N>
+T SmallXArrayList<T, N>::removeAt(int index)
+{
+    checkIndex(index);
+    T item = std::move(this->data[index]);
+
+    for (int i = index; i < this->count - 1; ++i)
+    {
+        data[i] = std::move(data[i + 1]);
+    }
+    destroyRange(this->data, this->count - 1, this->count);
+    this->count--;
+    return item;
+}
+
+template <class T, int N>
+bool SmallXArrayList<T, N>::removeItem(T item, void (*removeItemData)(T))
+{
+    for (int i = 0; i < this->count; i++)
+    {
+        if (equals(this->data[i], item, this->itemEqual))
+        {
+            if (removeItemData != nullptr)
+            {
+                removeItemData(this->data[i]);
+            }
+            removeAt(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+template <class T, int N>
+bool SmallXArrayList<T, N>::empty()
+{
+    return this->count == 0;
+}
+
+template <class T, int N>
+int SmallXArrayList<T, N>::size()
+{
+    return this->count;
+}
+
+template <class T, int N>
+void SmallXArrayList<T, N>::clear()
+{
+    // keep a spilled buffer for reuse, like XArrayList::clear
+    if (deleteUserData != nullptr)
+    {
+        deleteUserData(this);
+    }
+    destroyRange(this->data, 0, this->count);
+    this->count = 0;
+}
+
+template <class T, int N>
+T &SmallXArrayList<T, N>::get(int index)
+{
+    checkIndex(index);
+    return this->data[index];
+}
+
+template <class T, int N>
+int SmallXArrayList<T, N>::indexOf(T item)
+{
+    for (int i = 0; i < this->count; i++)
+    {
+        if (equals(this->data[i], item, this->itemEqual))
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+template <class T, int N>
+bool SmallXArrayList<T, N>::contains(T item)
+{
+    return indexOf(item) != -1;
+}
+
+template <class T, int N>
+string SmallXArrayList<T, N>::toString(string (*item2str)(T &))
+{
+    stringstream ss;
+    ss << "[";
+    for (int i = 0; i < this->count; ++i)
+    {
+        if (i > 0)
+        {
+            ss << ", ";
+        }
+        if (item2str)
+        {
+            ss << item2str(this->data[i]);
+        }
+        else
+        {
+            ss << this->data[i];
+        }
+    }
+    ss << "]";
+    return ss.str();
+}
+
+//////////////////////////////////////////////////////////////////////
+//////////////////////// (private) METHOD DEFNITION //////////////////
+//////////////////////////////////////////////////////////////////////
+template <class T, int N>
+void SmallXArrayList<T, N>::checkIndex(int index)
+{
+    if (index < 0 || index >= this->count)
+    {
+        throw out_of_range("Index is out of range!");
+    }
+}
+
+template <class T, int N>
+void SmallXArrayList<T, N>::ensureCapacity(int index)
+{
+    if (index <= this->capacity)
+    {
+        return;
+    }
+
+    int newCapacity = (this->capacity > 0) ? this->capacity : 1;
+    while (newCapacity < index)
+    {
+        newCapacity *= 2;
+    }
+
+    if (isInline())
+    {
+        // spill: move the inline items to the heap
+        T *newData = allocRaw<T>(newCapacity);
+        for (int i = 0; i < this->count; i++)
+        {
+            new (&newData[i]) T(std::move(this->data[i]));
+        }
+        destroyRange(this->data, 0, this->count);
+        this->data = newData;
+    }
+    else
+    {
+        this->data = reallocRaw(this->data, this->count, this->capacity, newCapacity);
+    }
+    this->capacity = newCapacity;
+}
+
+#endif /* SMALLXARRAYLIST_H */
@@ -0,0 +1,601 @@
+/*
+ * File:   TreapList.h
+ */
+
+#ifndef TREAPLIST_H
+#define TREAPLIST_H
+#include "list/IList.h"
+#include <sstream>
+#include <iostream>
+#include <stdexcept>
+#include <cstdint>
+#include <utility>
+using namespace std;
+
+/*
+ * TreapList<T>: an order-statistic list, stored as an implicit treap.
+ *  The tree is ordered by position (no keys): each node keeps the size of its
+ *  subtree, so the index of an item is the number of items on its left.
+ *  The shape is balanced on average by random node priorities (a max-heap).
+ *  + add(index, e), removeAt(index), get(index): O(log n) expected, at any position
+ *  + splitAt(index, rest), concat(other): O(log n) expected, no item is copied
+ *  + traversal (indexOf, toString, free) visits the tree in order: O(n)
+ *  For example:
+ *      TreapList<int> list;
+ *      ...
+ *      TreapList<int> tail;
+ *      list.splitAt(list.size() / 2, tail);   // list: first half, tail: second half
+ *      tail.concat(list);                     // tail: second half + first half; list: empty
+ */
+template <class T>
+class TreapList : public IList<T>
+{
+public:
+    class Iterator; // forward declaration
+
+protected:
+    struct Node
+    {
+        T data;
+        Node *left;
+        Node *right;
+        int size;          // number of nodes in this subtree
+        uint32_t priority; // the parent's priority is never smaller
+
+        Node(T data, uint32_t priority) : data(std::move(data))
+        {
+            this->left = this->right = nullptr;
+            this->size = 1;
+            this->priority = priority;
+        }
+    };
+
+    Node *root;                                // nullptr: empty list
+    uint32_t seed;                             // state of the priority generator (xorshift32)
+    bool (*itemEqual)(T &lhs, T &rhs);         // function pointer: test if two items (type: T&) are equal or not
+    void (*deleteUserData)(TreapList<T> *);    // function pointer: be called to remove items (if they are pointer type)
+
+public:
+    TreapList(
+        void (*deleteUserData)(TreapList<T> *) = 0,
+        bool (*itemEqual)(T &, T &) = 0);
+    TreapList(const TreapList<T> &list);
+    TreapList<T> &operator=(const TreapList<T> &list);
+    ~TreapList();
+
+    // Inherit from IList: BEGIN
+    void add(T e);
+    void add(int index, T e);
+    T removeAt(int index);
+    bool removeItem(T item, void (*removeItemData)(T) = 0);
+    bool empty();
+    int size();
+    void clear();
+    T &get(int index);
+    int indexOf(T item);
+    bool contains(T item);
+    string toString(string (*item2str)(T &) = 0);
+    // Inherit from IList: END
+
+    /* splitAt(index, rest): the items [index, size()) are moved to "rest";
+     *  this list keeps [0, index). The previous items of "rest" are removed first.
+     */
+    void splitAt(int index, TreapList<T> &rest);
+    /* concat(other): the items of "other" are moved to the end of this list;
+     *  "other" becomes empty.
+     */
+    void concat(TreapList<T> &other);
+
+    void println(string (*item2str)(T &) = 0)
+    {
+        cout << toString(item2str) << endl;
+    }
+    void setDeleteUserDataPtr(void (*deleteUserData)(TreapList<T> *) = 0)
+    {
+        this->deleteUserData = deleteUserData;
+    }
+
+    Iterator begin()
+    {
+        return Iterator(this, 0);
+    }
+    Iterator end()
+    {
+        return Iterator(this, size());
+    }
+
+    /** free:
+     * if T is pointer type:
+     *     pass THE address of method "free" to TreapList<T>'s constructor
+     * Example:
+     *  TreapList<Point*> list(&TreapList<Point*>::free);
+     */
+    static void free(TreapList<T> *list)
+    {
+        deleteItems(list->root);
+    }
+
+protected:
+    void checkIndex(int index); // check validity of index for accessing
+    uint32_t nextPriority();
+
+    static int sizeOf(Node *pNode)
+    {
+        return (pNode == nullptr) ? 0 : pNode->size;
+    }
+    static void update(Node *pNode)
+    {
+        pNode->size = 1 + sizeOf(pNode->left) + sizeOf(pNode->right);
+    }
+    static void deleteItems(Node *pNode)
+    {
+        for (; pNode != nullptr; pNode = pNode->right)
+        {
+            deleteItems(pNode->left);
+            delete pNode->data;
+        }
+    }
+
+    // treap primitives: recursion depth is the height of the tree, O(log n) expected
+    static Node *join(Node *left, Node *right);                       // all of "left" before all of "right"
+    static void split(Node *pNode, int k, Node *&left, Node *&right); // left: the first k items
+    static Node *insertAt(Node *pNode, int index, Node *pNew);
+    static Node *eraseAt(Node *pNode, int index, Node *&removed);
+    static Node *clone(Node *pNode);
+    static void destroy(Node *pNode);
+    static int find(Node *pNode, T &item, int offset, bool (*itemEqual)(T &, T &));
+    static void print(Node *pNode, stringstream &ss, bool &first, string (*item2str)(T &));
+
+    static bool equals(T &lhs, T &rhs, bool (*itemEqual)(T &, T &))
+    {
+        if (itemEqual == 0)
+            return lhs == rhs;
+        else
+            return itemEqual(lhs, rhs);
+    }
+
+    void removeInternalData();
+
+    //////////////////////////////////////////////////////////////////////
+    ////////////////////////  INNER CLASSES DEFNITION ////////////////////
+    //////////////////////////////////////////////////////////////////////
+public:
+    // Iterator: BEGIN
+    class Iterator
+    {
+    private:
+        int cursor;
+        TreapList<T> *pList;
+
+    public:
+        Iterator(TreapList<T> *pList = 0, int index = 0)
+        {
+            this->pList = pList;
+            this->cursor = index;
+        }
+        Iterator(const Iterator &iterator)
+        {
+            cursor = iterator.cursor;
+            pList = iterator.pList;
+        }
+        Iterator &operator=(const Iterator &iterator)
+        {
+            cursor = iterator.cursor;
+            pList = iterator.pList;
+            return *this;
+        }
+        void remove(void (*removeItemData)(T) = 0)
+        {
+            T item = pList->removeAt(cursor);
+            if (removeItemData != 0)
+                removeItemData(item);
+            cursor -= 1; // MUST keep index of previous, for ++ later
+        }
+
+        T &operator*()
+        {
+            return pList->get(cursor);
+        }
+        bool operator!=(const Iterator &iterator)
+        {
+            return cursor != iterator.cursor;
+        }
+        // Prefix ++ overload
+        Iterator &operator++()
+        {
+            this->cursor++;
+            return *this;
+        }
+        // Postfix ++ overload
+        Iterator operator++(int)
+        {
+            Iterator iterator = *this;
+            ++*this;
+            return iterator;
+        }
+    };
+    // Iterator: END
+};
+
+//////////////////////////////////////////////////////////////////////
+////////////////////////     METHOD DEFNITION      ///////////////////
+//////////////////////////////////////////////////////////////////////
+
+template <class T>
+TreapList<T>::TreapList(
+    void (*deleteUserData)(TreapList<T> *),
+    bool (*itemEqual)(T &, T &))
+{
+    this->deleteUserData = deleteUserData;
+    this->itemEqual = itemEqual;
+    this->root = nullptr;
+    // different lists draw different priorities (they may be concatenated later)
+    this->seed = (uint32_t)(reinterpret_cast<uintptr_t>(this) >> 4) * 2654435761u | 1u;
+}
+
+template <class T>
+TreapList<T>::TreapList(const TreapList<T> &list)
+{
+    this->deleteUserData = list.deleteUserData;
+    this->itemEqual = list.itemEqual;
+    this->seed = (uint32_t)(reinterpret_cast<uintptr_t>(this) >> 4) * 2654435761u | 1u;
+    this->root = clone(list.root);
+}
+
+template <class T>
+TreapList<T> &TreapList<T>::operator=(const TreapList<T> &list)
+{
+    if (this != &list)
+    {
+        removeInternalData();
+        this->deleteUserData = list.deleteUserData;
+        this->itemEqual = list.itemEqual;
+        this->root = clone(list.root);
+    }
+    return *this;
+}
+
+template <class T>
+TreapList<T>::~TreapList()
+{
+    removeInternalData();
+}
+
+template <class T>
+void TreapList<T>::add(T e)
+{
+    add(sizeOf(this->root), std::move(e));
+}
+
+template <class T>
+void TreapList<T>::add(int index, T e)
+{
+    if (index < 0 || index > sizeOf(this->root))
+    {
+        throw out_of_range("Index is out of range!");
+    }
+    Node *pNew = new Node(std::move(e), nextPriority());
+    this->root = insertAt(this->root, index, pNew);
+}
+
+template <class T>
+T TreapList<T>::removeAt(int index)
+{
+    checkIndex(index);
+    Node *removed = nullptr;
+    this->root = eraseAt(this->root, index, removed);
+    T item = std::move(removed->data);
+    delete removed;
+    return item;
+}
+
+template <class T>
+bool TreapList<T>::removeItem(T item, void (*removeItemData)(T))
+{
+    int index = indexOf(item);
+    if (index == -1)
+    {
+        return false;
+    }
+    T removed = removeAt(index);
+    if (removeItemData != nullptr)
+    {
+        removeItemData(removed);
+    }
+    return true;
+}
+
+template <class T>
+bool TreapList<T>::empty()
+{
+    return this->root == nullptr;
+}
+
+template <class T>
+int TreapList<T>::size()
+{
+    return sizeOf(this->root);
+}
+
+template <class T>
+void TreapList<T>::clear()
+{
+    removeInternalData();
+}
+
+template <class T>
+T &TreapList<T>::get(int index)
+{
+    checkIndex(index);
+    Node *pNode = this->root;
+    while (true)
+    {
+        int leftSize = sizeOf(pNode->left);
+        if (index < leftSize)
+        {
+            pNode = pNode->left;
+        }
+        else if (index == leftSize)
+        {
+            return pNode->data;
+        }
+        else
+        {
+            index -= leftSize + 1;
+            pNode = pNode->right;
+        }
+    }
+}
+
+template <class T>
+int TreapList<T>::indexOf(T item)
+{
+    return find(this->root, item, 0, this->itemEqual);
+}
+
+template <class T>
+bool TreapList<T>::contains(T item)
+{
+    return indexOf(item) != -1;
+}
+
+template <class T>
+string TreapList<T>::toString(string (*item2str)(T &))
+{
+    stringstream ss;
+    bool first = true;
+    ss << "[";
+    print(this->root, ss, first, item2str);
+    ss << "]";
+    return ss.str();
+}
+
+template <class T>
+void TreapList<T>::splitAt(int index, TreapList<T> &rest)
+{
+    if (index < 0 || index > sizeOf(this->root))
+    {
+        throw out_of_range("Index is out of range!");
+    }
+    if (&rest == this)
+    {
+        throw invalid_argument("TreapList::splitAt: rest must be another list");
+    }
+    rest.removeInternalData();
+    Node *left, *right;
+    split(this->root, index, left, right);
+    this->root = left;
+    rest.root = right;
+}
+
+template <class T>
+void TreapList<T>::concat(TreapList<T> &other)
+{
+    if (&other == this)
+    {
+        return;
+    }
+    this->root = join(this->root, other.root);
+    other.root = nullptr;
+}
+
+//////////////////////////////////////////////////////////////////////
+//////////////////////// (private) METHOD DEFNITION //////////////////
+//////////////////////////////////////////////////////////////////////
+template <class T>
+void TreapList<T>::checkIndex(int index)
+{
+    if (index < 0 || index >= sizeOf(this->root))
+    {
+        throw out_of_range("Index is out of range!");
+    }
+}
+
+template <class T>
+uint32_t TreapList<T>::nextPriority()
+{
+    uint32_t x = this->seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    this->seed = x;
+    return x;
+}
+
+template <class T>
+void TreapList<T>::removeInternalData()
+{
+    if (this->deleteUserData != nullptr)
+    {
+        this->deleteUserData(this);
+    }
+    destroy(this->root);
+    this->root = nullptr;
+}
+
+template <class T>
+typename TreapList<T>::Node *TreapList<T>::join(Node *left, Node *right)
+{
+    if (left == nullptr)
+        return right;
+    if (right == nullptr)
+        return left;
+    if (left->priority > right->priority)
+    {
+        left->right = join(left->right, right);
+        update(left);
+        return left;
+    }
+    right->left = join(left, right->left);
+    update(right);
+    return right;
+}
+
+template <class T>
+void TreapList<T>::split(Node *pNode, int k, Node *&left, Node *&right)
+{
+    if (pNode == nullptr)
+    {
+        left = right = nullptr;
+        return;
+    }
+    int leftSize = sizeOf(pNode->left);
+    if (k <= leftSize)
+    {
+        split(pNode->left, k, left, pNode->left);
+        right = pNode;
+    }
+    else
+    {
+        split(pNode->right, k - leftSize - 1, pNode->right, right);
+        left = pNode;
+    }
+    update(pNode);
+}
+
+template <class T>
+typename TreapList<T>::Node *TreapList<T>::insertAt(Node *pNode, int index, Node *pNew)
+{
+    if (pNode == nullptr)
+    {
+        return pNew;
+    }
+    if (pNew->priority > pNode->priority)
+    {
+        // pNew becomes the root of this subtree
+        split(pNode, index, pNew->left, pNew->right);
+        update(pNew);
+        return pNew;
+    }
+    int leftSize = sizeOf(pNode->left);
+    if (index <= leftSize)
+    {
+        pNode->left = insertAt(pNode->left, index, pNew);
+    }
+    else
+    {
+        pNode->right = insertAt(pNode->right, index - leftSize - 1, pNew);
+    }
+    pNode->size++;
+    return pNode;
+}
+
+template <class T>
+typename TreapList<T>::Node *TreapList<T>::eraseAt(Node *pNode, int index, Node *&removed)
+{
+    int leftSize = sizeOf(pNode->left);
+    if (index == leftSize)
+    {
+        removed = pNode;
+        return join(pNode->left, pNode->right);
+    }
+    if (index < leftSize)
+    {
+        pNode->left = eraseAt(pNode->left, index, removed);
+    }
+    else
+    {
+        pNode->right = eraseAt(pNode->right, index - leftSize - 1, removed);
+    }
+    pNode->size--;
+    return pNode;
+}
+
+template <class T>
+typename TreapList<T>::Node *TreapList<T>::clone(Node *pNode)
+{
+    if (pNode == nullptr)
+    {
+        return nullptr;
+    }
+    Node *pCopy = new Node(pNode->data, pNode->priority);
+    pCopy->size = pNode->size;
+    try
+    {
+        pCopy->left = clone(pNode->left);
+        pCopy->right = clone(pNode->right);
+    }
+    catch (...)
+    {
+        destroy(pCopy);
+        throw;
+    }
+    return pCopy;
+}
+
+template <class T>
+void TreapList<T>::destroy(Node *pNode)
+{
+    // recurse on the left only: a long right spine does not grow the stack
+    while (pNode != nullptr)
+    {
+        destroy(pNode->left);
+        Node *next = pNode->right;
+        delete pNode;
+        pNode = next;
+    }
+}
+
+template <class T>
+int TreapList<T>::find(Node *pNode, T &item, int offset, bool (*itemEqual)(T &, T &))
+{
+    for (; pNode != nullptr; pNode = pNode->right)
+    {
+        int index = find(pNode->left, item, offset, itemEqual);
+        if (index != -1)
+        {
+            return index;
+        }
+        offset += sizeOf(pNode->left);
+        if (equals(pNode->data, item, itemEqual))
+        {
+            return offset;
+        }
+        offset++;
+    }
+    return -1;
+}
+
+template <class T>
+void TreapList<T>::print(Node *pNode, stringstream &ss, bool &first, string (*item2str)(T &))
+{
+    for (; pNode != nullptr; pNode = pNode->right)
+    {
+        print(pNode->left, ss, first, item2str);
+        if (!first)
+        {
+            ss << ", ";
+        }
+        first = false;
+        if (item2str)
+        {
+            ss << item2str(pNode->data);
+        }
+        else
+        {
+            ss << pNode->data;
+        }
+    }
+}
+
+#endif /* TREAPLIST_H */
@@ -0,0 +1,782 @@
+/*
+ * File:   UnrolledLinkedList.h
+ */
+
+#ifndef UNROLLEDLINKEDLIST_H
+#define UNROLLEDLINKEDLIST_H
+#include "list/IList.h"
+#include "util/MemLib.h"
+#include <sstream>
+#include <iostream>
+#include <stdexcept>
+using namespace std;
+
+/*
+ * UnrolledLinkedList<T, nodeCapacity>: a doubly linked list of nodes, each node
+ *  holding up to nodeCapacity items in a small array.
+ *  + add(index, e), removeAt(index): shift at most nodeCapacity items inside one node;
+ *      a full node is split in two halves, a node that gets too sparse is merged
+ *      with its successor
+ *  + get(index): O(log n); the per-node count index is a Fenwick tree over the
+ *      sizes of the nodes (in list order, see "directory")
+ *  + traversal (Iterator, indexOf, toString) reads the items array by array
+ *  For example:
+ *      UnrolledLinkedList<IList<int>*> rows;   // nodes of 32 rows
+ *      rows.add(rows.size() / 2, pRow);        // cheap insertion in the middle
+ */
+template <class T, int nodeCapacity = 32>
+class UnrolledLinkedList : public IList<T>
+{
+    static_assert(nodeCapacity >= 4, "UnrolledLinkedList: nodeCapacity must be at least 4");
+
+public:
+    class Iterator; // forward declaration
+
+protected:
+    struct Node
+    {
+        Node *next;
+        Node *prev;
+        int used; // items [0, used) are constructed
+        alignas(T) unsigned char storage[nodeCapacity * sizeof(T)];
+
+        T *items()
+        {
+            return reinterpret_cast<T *>(storage);
+        }
+    };
+
+    Node *head;                                                    // first node (nullptr: empty list)
+    Node *tail;                                                    // last node
+    int count;                                                     // number of items
+    Node **directory;                                              // directory[r]: the r-th node in list order
+    int *tree;                                                     // Fenwick tree (1-based) over directory[r - 1]->used
+    int numNodes;                                                  // number of nodes
+    int directoryCapacity;                                         // size of directory (tree: directoryCapacity + 1)
+    bool (*itemEqual)(T &lhs, T &rhs);                             // function pointer: test if two items (type: T&) are equal or not
+    void (*deleteUserData)(UnrolledLinkedList<T, nodeCapacity> *); // function pointer: be called to remove items (if they are pointer type)
+
+public:
+    UnrolledLinkedList(
+        void (*deleteUserData)(UnrolledLinkedList<T, nodeCapacity> *) = 0,
+        bool (*itemEqual)(T &, T &) = 0);
+    UnrolledLinkedList(const UnrolledLinkedList<T, nodeCapacity> &list);
+    UnrolledLinkedList<T, nodeCapacity> &operator=(const UnrolledLinkedList<T, nodeCapacity> &list);
+    ~UnrolledLinkedList();
+
+    // Inherit from IList: BEGIN
+    void add(T e);
+    void add(int index, T e);
+    T removeAt(int index);
+    bool removeItem(T item, void (*removeItemData)(T) = 0);
+    bool empty();
+    int size();
+    void clear();
+    T &get(int index);
+    int indexOf(T item);
+    bool contains(T item);
+    string toString(string (*item2str)(T &) = 0);
+    // Inherit from IList: END
+
+    void println(string (*item2str)(T &) = 0)
+    {
+        cout << toString(item2str) << endl;
+    }
+    void setDeleteUserDataPtr(void (*deleteUserData)(UnrolledLinkedList<T, nodeCapacity> *) = 0)
+    {
+        this->deleteUserData = deleteUserData;
+    }
+    /* nodeCount(): number of nodes (arrays of at most nodeCapacity items)
+     */
+    int nodeCount()
+    {
+        return this->numNodes;
+    }
+
+    Iterator begin()
+    {
+        return Iterator(this, 0);
+    }
+    Iterator end()
+    {
+        return Iterator(this, count);
+    }
+
+    /** free:
+     * if T is pointer type:
+     *     pass THE address of method "free" to UnrolledLinkedList<T>'s constructor
+     * Example:
+     *  UnrolledLinkedList<Point*> list(&UnrolledLinkedList<Point*>::free);
+     */
+    static void free(UnrolledLinkedList<T, nodeCapacity> *list)
+    {
+        for (Node *pNode = list->head; pNode != nullptr; pNode = pNode->next)
+            for (int i = 0; i < pNode->used; i++)
+                delete pNode->items()[i];
+    }
+
+protected:
+    void checkIndex(int index); // check validity of index for accessing
+    Node *locate(int index, int &offset, int &rank);
+
+    // the count index (rank: position of a node in the directory)
+    int prefixCount(int rank); // number of items in directory[0..rank-1]
+    void updateCount(int rank, int delta);
+    void insertRank(int rank, Node *pNode);
+    void eraseRank(int rank);
+    void toSizes(int from);
+    void toTree(int from);
+    void ensureDirectory(int minCapacity);
+
+    Node *appendNode();
+    void removeNode(Node *pNode, int rank);
+    void splitNode(Node *pNode, int rank);
+    void mergeWithNext(Node *pNode, int rank);
+
+    static bool equals(T &lhs, T &rhs, bool (*itemEqual)(T &, T &))
+    {
+        if (itemEqual == 0)
+            return lhs == rhs;
+        else
+            return itemEqual(lhs, rhs);
+    }
+
+    void copyFrom(const UnrolledLinkedList<T, nodeCapacity> &list);
+    void removeInternalData();
+
+    //////////////////////////////////////////////////////////////////////
+    ////////////////////////  INNER CLASSES DEFNITION ////////////////////
+    //////////////////////////////////////////////////////////////////////
+public:
+    // Iterator: BEGIN
+    class Iterator
+    {
+    private:
+        int cursor;
+        Node *pNode; // node of item "cursor" (nullptr: to be located)
+        int offset;  // position of item "cursor" in pNode
+        UnrolledLinkedList<T, nodeCapacity> *pList;
+
+        void relocate()
+        {
+            int rank;
+            if (cursor >= 0 && cursor < pList->count)
+                pNode = pList->locate(cursor, offset, rank);
+            else
+                pNode = nullptr;
+        }
+
+    public:
+        Iterator(UnrolledLinkedList<T, nodeCapacity> *pList = 0, int index = 0)
+        {
+            this->pList = pList;
+            this->cursor = index;
+            this->pNode = nullptr;
+            this->offset = 0;
+            if (pList != 0)
+                relocate();
+        }
+        Iterator(const Iterator &iterator)
+        {
+            cursor = iterator.cursor;
+            pNode = iterator.pNode;
+            offset = iterator.offset;
+            pList = iterator.pList;
+        }
+        Iterator &operator=(const Iterator &iterator)
+        {
+            cursor = iterator.cursor;
+            pNode = iterator.pNode;
+            offset = iterator.offset;
+            pList = iterator.pList;
+            return *this;
+        }
+        void remove(void (*removeItemData)(T) = 0)
+        {
+            T item = pList->removeAt(cursor);
+            if (removeItemData != 0)
+                removeItemData(item);
+            cursor -= 1; // MUST keep index of previous, for ++ later
+            pNode = nullptr;
+        }
+
+        T &operator*()
+        {
+            if (pNode == nullptr)
+                relocate();
+            return pNode->items()[offset];
+        }
+        bool operator!=(const Iterator &iterator)
+        {
+            return cursor != iterator.cursor;
+        }
+        // Prefix ++ overload
+        Iterator &operator++()
+        {
+            this->cursor++;
+            if (pNode != nullptr && offset + 1 < pNode->used)
+            {
+                offset++;
+            }
+            else if (pNode != nullptr && pNode->next != nullptr)
+            {
+                pNode = pNode->next;
+                offset = 0;
+            }
+            else
+            {
+                relocate();
+            }
+            return *this;
+        }
+        // Postfix ++ overload
+        Iterator operator++(int)
+        {
+            Iterator iterator = *this;
+            ++*this;
+            return iterator;
+        }
+    };
+    // Iterator: END
+};
+
+//////////////////////////////////////////////////////////////////////
+////////////////////////     METHOD DEFNITION      ///////////////////
+//////////////////////////////////////////////////////////////////////
+
+template <class T, int nodeCapacity>
+UnrolledLinkedList<T, nodeCapacity>::UnrolledLinkedList(
+    void (*deleteUserData)(UnrolledLinkedList<T, nodeCapacity> *),
+    bool (*itemEqual)(T &, T &))
+{
+    this->deleteUserData = deleteUserData;
+    this->itemEqual = itemEqual;
+    this->head = this->tail = nullptr;
+    this->count = 0;
+    this->directory = nullptr;
+    this->tree = nullptr;
+    this->numNodes = 0;
+    this->directoryCapacity = 0;
+}
+
+template <class T, int nodeCapacity>
+void UnrolledLinkedList<T, nodeCapacity>::copyFrom(const UnrolledLinkedList<T, nodeCapacity> &list)
+{
+    this->head = this->tail = nullptr;
+    this->count = 0;
+    this->directory = nullptr;
+    this->tree = nullptr;
+    this->numNodes = 0;
+    this->directoryCapacity = 0;
+    this->deleteUserData = list.deleteUserData;
+    this->itemEqual = list.itemEqual;
+
+    for (Node *pNode = list.head; pNode != nullptr; pNode = pNode->next)
+    {
+        for (int i = 0; i < pNode->used; i++)
+        {
+            add(pNode->items()[i]);
+        }
+    }
+}
+
+template <class T, int nodeCapacity>
+void UnrolledLinkedList<T, nodeCapacity>::removeInternalData()
+{
+    if (deleteUserData != nullptr)
+    {
+        deleteUserData(this);
+    }
+    Node *pNode = this->head;
+    while (pNode != nullptr)
+    {
+        Node *next = pNode->next;
+        destroyRange(pNode->items(), 0, pNode->used);
+        delete pNode;
+        pNode = next;
+    }
+    delete[] this->directory;
+    delete[] this->tree;
+    this->head = this->tail = nullptr;
+    this->count = 0;
+    this->directory = nullptr;
+    this->tree = nullptr;
+    this->numNodes = 0;
+    this->directoryCapacity = 0;
+}
+
+template <class T, int nodeCapacity>
+UnrolledLinkedList<T, nodeCapacity>::UnrolledLinkedList(const UnrolledLinkedList<T, nodeCapacity> &list)
+{
+    copyFrom(list);
+}
+
+template <class T, int nodeCapacity>
+UnrolledLinkedList<T, nodeCapacity> &UnrolledLinkedList<T, nodeCapacity>::operator=(const UnrolledLinkedList<T, nodeCapacity> &list)
+{
+    if (this != &list)
+    {
+        removeInternalData();
+        copyFrom(list);
+    }
+    return *this;
+}
+
+template <class T, int nodeCapacity>
+UnrolledLinkedList<T, nodeCapacity>::~UnrolledLinkedList()
+{
+    removeInternalData();
+}
+
+template <class T, int nodeCapacity>
+void UnrolledLinkedList<T, nodeCapacity>::add(T e)
+{
+    Node *pNode = this->tail;
+    if (pNode == nullptr || pNode->used == nodeCapacity)
+    {
+        pNode = appendNode();
+    }
+    new (&pNode->items()[pNode->used]) T(std::move(e));
+    pNode->used++;
+    updateCount(this->numNodes - 1, 1);
+    this->count++;
+}
+
+template <class T, int nodeCapacity>
+void UnrolledLinkedList<T, nodeCapacity>::add(int index, T e)
+{
+    if (index < 0 || index > this->count)
+    {
+        throw out_of_range("Index is out of range!");
+    }
+    if (index == this->count)
+    {
+        add(e);
+        return;
+    }
+
+    int offset, rank;
+    Node *pNode = locate(index, offset, rank);
+    if (pNode->used == nodeCapacity)
+    {
+        splitNode(pNode, rank);
+        if (offset > pNode->used)
+        {
+            offset -= pNode->used;
+            pNode = pNode->next;
+            rank++;
+        }
+    }
+
+    // the slot at used is raw memory: construct it, then shift the rest
+    T *items = pNode->items();
+    if (offset < pNode->used)
+    {
+        new (&items[pNode->used]) T(std::move(items[pNode->used - 1]));
+        for (int i = pNode->used - 1; i > offset; i--)
+        {
+            items[i] = std::move(items[i - 1]);
+        }
+        items[offset] = std::move(e);
+    }
+    else
+    {
+        new (&items[offset]) T(std::move(e));
+    }
+    pNode->used++;
+    updateCount(rank, 1);
+    this->count++;
+}
+
+template <class T, int nodeCapacity>
+T UnrolledLinkedList<T, nodeCapacity>::removeAt(int index)
+{
+    checkIndex(index);
+    int offset, rank;
+    Node *pNode = locate(index, offset, rank);
+    T *items = pNode->items();
+    T item = std::move(items[offset]);
+
+    for (int i = offset; i < pNode->used - 1; ++i)
+    {
+        items[i] = std::move(items[i + 1]);
+    }
+    destroyRange(items, pNode->used - 1, pNode->used);
+    pNode->used--;
+    updateCount(rank, -1);
+    this->count--;
+
+    if (pNode->used == 0)
+    {
+        removeNode(pNode, rank);
+    }
+    else if (pNode->next != nullptr && pNode->used + pNode->next->used <= nodeCapacity / 2)
+    {
+        // both nodes are sparse: one half-full node replaces them
+        mergeWithNext(pNode, rank);
+    }
+    else if (pNode->prev != nullptr && pNode->used + pNode->prev->used <= nodeCapacity / 2)
+    {
+        mergeWithNext(pNode->prev, rank - 1);
+    }
+    return item;
+}
+
+template <class T, int nodeCapacity>
+bool UnrolledLinkedList<T, nodeCapacity>::removeItem(T item, void (*removeItemData)(T))
+{
+    int index = indexOf(item);
+    if (index == -1)
+    {
+        return false;
+    }
+    if (removeItemData != nullptr)
+    {
+        removeItemData(get(index));
+    }
+    removeAt(index);
+    return true;
+}
+
+template <class T, int nodeCapacity>
+bool UnrolledLinkedList<T, nodeCapacity>::empty()
+{
+    return this->count == 0;
+}
+
+template <class T, int nodeCapacity>
+int UnrolledLinkedList<T, nodeCapacity>::size()
+{
+    return this->count;
+}
+
+template <class T, int nodeCapacity>
+void UnrolledLinkedList<T, nodeCapacity>::clear()
+{
+    removeInternalData();
+}
+
+template <class T, int nodeCapacity>
+T &UnrolledLinkedList<T, nodeCapacity>::get(int index)
+{
+    checkIndex(index);
+    int offset, rank;
+    Node *pNode = locate(index, offset, rank);
+    return pNode->items()[offset];
+}
+
+template <class T, int nodeCapacity>
+int UnrolledLinkedList<T, nodeCapacity>::indexOf(T item)
+{
+    int index = 0;
+    for (Node *pNode = this->head; pNode != nullptr; pNode = pNode->next)
+    {
+        T *items = pNode->items();
+        for (int i = 0; i < pNode->used; i++)
+        {
+            if (equals(items[i], item, this->itemEqual))
+            {
+                return index + i;
+            }
+        }
+        index += pNode->used;
+    }
+    return -1;
+}
+
+template <class T, int nodeCapacity>
+bool UnrolledLinkedList<T, nodeCapacity>::contains(T item)
+{
+    return indexOf(item) != -1;
+}
+
+template <class T, int nodeCapacity>
+string UnrolledLinkedList<T, nodeCapacity>::toString(string (*item2str)(T &))
+{
+    stringstream ss;
+    ss << "[";
+    bool first = true;
+    for (Node *pNode = this->head; pNode != nullptr; pNode = pNode->next)
+    {
+        T *items = pNode->items();
+        for (int i = 0; i < pNode->used; i++)
+        {
+            if (!first)
+            {
+                ss << ", ";
+            }
+            first = false;
+            if (item2str)
+            {
+                ss << item2str(items[i]);
+            }
+            else
+            {
+                ss << items[i];
+            }
+        }
+    }
+    ss << "]";
+    return ss.str();
+}
+
+//////////////////////////////////////////////////////////////////////
+//////////////////////// (private) METHOD DEFNITION //////////////////
+//////////////////////////////////////////////////////////////////////
+template <class T, int nodeCapacity>
+void UnrolledLinkedList<T, nodeCapacity>::checkIndex(int index)
+{
+    if (index < 0 || index >= this->count)
+    {
+        throw out_of_range("Index is out of range!");
+    }
+}
+
+/*
+ * locate(index, offset, rank): the node holding item "index"; offset receives its
+ *  position inside the node, rank the position of the node in the directory.
+ *  Descends the Fenwick tree: O(log(number of nodes)).
+ */
+template <class T, int nodeCapacity>
+typename UnrolledLinkedList<T, nodeCapacity>::Node *UnrolledLinkedList<T, nodeCapacity>::locate(int index, int &offset, int &rank)
+{
+    int step = 1;
+    while (step * 2 <= this->numNodes)
+    {
+        step *= 2;
+    }
+    int position = 0; // number of nodes skipped
+    int remain = index;
+    for (; step > 0; step /= 2)
+    {
+        if (position + step <= this->numNodes && this->tree[position + step] <= remain)
+        {
+            position += step;
+            remain -= this->tree[position];
+        }
+    }
+    offset = remain;
+    rank = position;
+    return this->directory[position];
+}
+
+template <class T, int nodeCapacity>
+int UnrolledLinkedList<T, nodeCapacity>::prefixCount(int rank)
+{
+    int sum = 0;
+    for (int i = rank; i > 0; i -= i & (-i))
+    {
+        sum += this->tree[i];
+    }
+    return sum;
+}
+
+template <class T, int nodeCapacity>
+void UnrolledLinkedList<T, nodeCapacity>::updateCount(int rank, int delta)
+{
+    for (int i = rank + 1; i <= this->numNodes; i += i & (-i))
+    {
+        this->tree[i] += delta;
+    }
+}
+
+/*
+ * insertRank, eraseRank: insert (remove) a node in the middle of the directory.
+ *  The Fenwick entries after rank are turned back into plain sizes, shifted, and
+ *  rebuilt (see toSizes/toTree): O(number of nodes after rank), on two contiguous
+ *  arrays only (the nodes are not read). Happens only on a split or a merge,
+ *  i.e., at most once every nodeCapacity / 2 updates of the same node.
+ */
+template <class T, int nodeCapacity>
+void UnrolledLinkedList<T, nodeCapacity>::insertRank(int rank, Node *pNode)
+{
+    ensureDirectory(this->numNodes + 1);
+    toSizes(rank);
+    for (int r = this->numNodes; r > rank; r--)
+    {
+        this->directory[r] = this->directory[r - 1];
+        this->tree[r + 1] = this->tree[r];
+    }
+    this->directory[rank] = pNode;
+    this->tree[rank + 1] = pNode->used;
+    this->numNodes++;
+    toTree(rank);
+}
+
+template <class T, int nodeCapacity>
+void UnrolledLinkedList<T, nodeCapacity>::eraseRank(int rank)
+{
+    toSizes(rank);
+    for (int r = rank; r < this->numNodes - 1; r++)
+    {
+        this->directory[r] = this->directory[r + 1];
+        this->tree[r + 1] = this->tree[r + 2];
+    }
+    this->numNodes--;
+    toTree(rank);
+}
+
+/*
+ * toSizes(from): tree[i] becomes the size of node i - 1, for every i > from;
+ *  tree[1..from] cover ranks before "from" only: they are kept as they are.
+ *  A Fenwick entry is its own size plus the entries of its children, so the children
+ *  are subtracted: those after "from", and those on the prefix path of "from".
+ * toTree(from): the reverse.
+ */
+template <class T, int nodeCapacity>
+void UnrolledLinkedList<T, nodeCapacity>::toSizes(int from)
+{
+    int n = this->numNodes;
+    for (int i = n; i > from; i--)
+    {
+        int parent = i + (i & (-i));
+        if (parent <= n)
+            this->tree[parent] -= this->tree[i];
+    }
+    for (int i = from; i > 0; i -= i & (-i))
+    {
+        int parent = i + (i & (-i));
+        if (parent <= n)
+            this->tree[parent] -= this->tree[i];
+    }
+}
+
+template <class T, int nodeCapacity>
+void UnrolledLinkedList<T, nodeCapacity>::toTree(int from)
+{
+    int n = this->numNodes;
+    for (int i = from; i > 0; i -= i & (-i))
+    {
+        int parent = i + (i & (-i));
+        if (parent <= n)
+            this->tree[parent] += this->tree[i];
+    }
+    for (int i = from + 1; i <= n; i++)
+    {
+        int parent = i + (i & (-i));
+        if (parent <= n)
+            this->tree[parent] += this->tree[i];
+    }
+}
+
+template <class T, int nodeCapacity>
+void UnrolledLinkedList<T, nodeCapacity>::ensureDirectory(int minCapacity)
+{
+    if (minCapacity <= this->directoryCapacity)
+    {
+        return;
+    }
+    int newCapacity = (this->directoryCapacity > 0) ? this->directoryCapacity : 4;
+    while (newCapacity < minCapacity)
+    {
+        newCapacity *= 2;
+    }
+    Node **newDirectory = new Node *[newCapacity];
+    int *newTree = new int[newCapacity + 1];
+    for (int r = 0; r < this->numNodes; r++)
+    {
+        newDirectory[r] = this->directory[r];
+    }
+    for (int i = 0; i <= this->numNodes; i++)
+    {
+        newTree[i] = (this->tree != nullptr) ? this->tree[i] : 0;
+    }
+    delete[] this->directory;
+    delete[] this->tree;
+    this->directory = newDirectory;
+    this->tree = newTree;
+    this->directoryCapacity = newCapacity;
+}
+
+/*
+ * appendNode: new empty node after tail, O(log(number of nodes)):
+ *  the Fenwick entry of the new last rank covers ranks it already contains
+ */
+template <class T, int nodeCapacity>
+typename UnrolledLinkedList<T, nodeCapacity>::Node *UnrolledLinkedList<T, nodeCapacity>::appendNode()
+{
+    ensureDirectory(this->numNodes + 1);
+    Node *pNode = new Node;
+    pNode->used = 0;
+    pNode->next = nullptr;
+    pNode->prev = this->tail;
+    if (this->tail != nullptr)
+        this->tail->next = pNode;
+    else
+        this->head = pNode;
+    this->tail = pNode;
+
+    this->directory[this->numNodes] = pNode;
+    this->numNodes++;
+    int i = this->numNodes;
+    this->tree[i] = prefixCount(i - 1) - prefixCount(i - (i & (-i)));
+    return pNode;
+}
+
+template <class T, int nodeCapacity>
+void UnrolledLinkedList<T, nodeCapacity>::removeNode(Node *pNode, int rank)
+{
+    if (pNode->prev != nullptr)
+        pNode->prev->next = pNode->next;
+    else
+        this->head = pNode->next;
+    if (pNode->next != nullptr)
+        pNode->next->prev = pNode->prev;
+    else
+        this->tail = pNode->prev;
+
+    eraseRank(rank);
+    destroyRange(pNode->items(), 0, pNode->used);
+    delete pNode;
+}
+
+/*
+ * splitNode: move the upper half of a full node into a new node after it
+ */
+template <class T, int nodeCapacity>
+void UnrolledLinkedList<T, nodeCapacity>::splitNode(Node *pNode, int rank)
+{
+    Node *pNew = new Node;
+    int keep = pNode->used / 2;
+    T *from = pNode->items();
+    T *to = pNew->items();
+    for (int i = keep; i < pNode->used; i++)
+    {
+        new (&to[i - keep]) T(std::move(from[i]));
+    }
+    destroyRange(from, keep, pNode->used);
+    pNew->used = pNode->used - keep;
+    pNode->used = keep;
+    updateCount(rank, -pNew->used);
+
+    pNew->prev = pNode;
+    pNew->next = pNode->next;
+    if (pNode->next != nullptr)
+        pNode->next->prev = pNew;
+    else
+        this->tail = pNew;
+    pNode->next = pNew;
+    insertRank(rank + 1, pNew);
+}
+
+/*
+ * mergeWithNext: move all the items of pNode->next to the end of pNode, remove pNode->next
+ */
+template <class T, int nodeCapacity>
+void UnrolledLinkedList<T, nodeCapacity>::mergeWithNext(Node *pNode, int rank)
+{
+    Node *pNext = pNode->next;
+    T *from = pNext->items();
+    T *to = pNode->items();
+    for (int i = 0; i < pNext->used; i++)
+    {
+        new (&to[pNode->used + i]) T(std::move(from[i]));
+    }
+    pNode->used += pNext->used;
+    updateCount(rank, pNext->used);
+    destroyRange(from, 0, pNext->used);
+    pNext->used = 0;
+    removeNode(pNext, rank + 1); // its count is already moved
+}
+
+#endif /* UNROLLEDLINKEDLIST_H */
@@ -5,6 +5,9 @@
  #ifndef XARRAYLIST_H
  #define XARRAYLIST_H
  #include "list/IList.h"
+ #include "util/MemLib.h"
+ #include "util/SearchLib.h"
+ #include "util/SortLib.h"
  #include <memory.h>
  #include <sstream>
  #include <iostream>
@@ -17,26 +20,28 @@
 //  template <typename T1, typename T2>
 //  struct is_specialization_of_pair<std::pair<T1, T2>> : std::true_type {};
 
- template <class T>
+ template <class T, class Alloc = MallocAllocator>
  class XArrayList : public IList<T>
  {
  public:
      class Iterator; // forward declaration
  
  protected:
-     T *data;                                 // dynamic array to store the list's items
-     int capacity;                            // size of the dynamic array
-     int count;                               // number of items stored in the array
-     bool (*itemEqual)(T &lhs, T &rhs);       // function pointer: test if two items (type: T&) are equal or not
-     void (*deleteUserData)(XArrayList<T> *); // function pointer: be called to remove items (if they are pointer type)
+     T *data;                                        // dynamic array to store the list's items (see util/MemLib.h)
+     int capacity;                                   // size of the dynamic array
+     int count;                                      // number of items stored in the array: only data[0..count-1] are constructed
+     int gapStart;                                   // see closeGap: while gapSize > 0, items [gapStart, count) live at data[gapStart + gapSize ...]
+     int gapSize;                                    // raw slots left inside the array by Iterator::remove (0: no gap)
+     bool (*itemEqual)(T &lhs, T &rhs);              // function pointer: test if two items (type: T&) are equal or not
+     void (*deleteUserData)(XArrayList<T, Alloc> *); // function pointer: be called to remove items (if they are pointer type)
  
  public:
      XArrayList(
-         void (*deleteUserData)(XArrayList<T> *) = 0,
+         void (*deleteUserData)(XArrayList<T, Alloc> *) = 0,
          bool (*itemEqual)(T &, T &) = 0,
          int capacity = 10);
-     XArrayList(const XArrayList<T> &list);
-     XArrayList<T> &operator=(const XArrayList<T> &list);
+     XArrayList(const XArrayList<T, Alloc> &list);
+     XArrayList<T, Alloc> &operator=(const XArrayList<T, Alloc> &list);
      ~XArrayList();
  
      // Inherit from IList: BEGIN
@@ -52,16 +57,75 @@
      bool contains(T item);
      string toString(string (*item2str)(T &) = 0);
      // Inherit from IList: BEGIN
+
+     /* Range operations: each call moves the tail of the list at most ONCE
+      *  addAll(first, last), addAll(array, size): append all items
+      *  insertRange(index, first, last), insertRange(index, array, size):
+      *      insert all items at location "index" (in [0, size()]), keeping their order
+      *  removeRange(from, to): remove the items at [from, to)
+      *  removeIf(pred, removeItemData): remove every item for which pred(item) is true
+      *      and return the number of removed items
+      *  NOTE: the source range must not point into this list
+      */
+     template <class InputIt>
+     void addAll(InputIt first, InputIt last);
+     void addAll(T array[], int size);
+     template <class InputIt>
+     void insertRange(int index, InputIt first, InputIt last);
+     void insertRange(int index, T array[], int size);
+     void removeRange(int from, int to);
+     template <class Predicate>
+     int removeIf(Predicate pred, void (*removeItemData)(T) = 0);
+
+     /* Sorting (see util/SortLib.h)
+      *  comparator: int comparator(T& lhs, T& rhs), same convention as Heap:
+      *      negative if lhs must come before rhs, 0 if equal, positive otherwise;
+      *      a function pointer or a lambda; without it, operator < is used
+      *  sort(comparator): pdqsort, in place, NOT stable
+      *  stableSort(comparator): merge sort, equal items keep their order
+      *  parallelSort(comparator, threads): "threads" threads (0: one per core), NOT stable
+      *  parallelForEach(func, threads): func(item) for every item, in parallel;
+      *      func must not add/remove items nor throw
+      */
+     void sort();
+     template <class Comparator>
+     void sort(Comparator comparator);
+     void stableSort();
+     template <class Comparator>
+     void stableSort(Comparator comparator);
+     void parallelSort(int threads = 0);
+     template <class Comparator, class = typename enable_if<!is_arithmetic<Comparator>::value>::type>
+     void parallelSort(Comparator comparator, int threads = 0); // not picked for parallelSort(threads)
+     template <class Func>
+     void parallelForEach(Func func, int threads = 0);
  
      void println(string (*item2str)(T &) = 0)
      {
          cout << toString(item2str) << endl;
      }
-     void setDeleteUserDataPtr(void (*deleteUserData)(XArrayList<T> *) = 0)
+     void setDeleteUserDataPtr(void (*deleteUserData)(XArrayList<T, Alloc> *) = 0)
      {
          this->deleteUserData = deleteUserData;
      }
  
+     /** detachData:
+      * hands the internal buffer over to the caller (e.g., Heap<T>) without copying.
+      * "count" and "capacity" receive the size and the length of the buffer;
+      * the caller owns the buffer (destroyRange + freeRaw<T, Alloc>, see util/MemLib.h)
+      * and this list becomes empty.
+      */
+     T *detachData(int &count, int &capacity)
+     {
+         closeGap();
+         T *pData = this->data;
+         count = this->count;
+         capacity = this->capacity;
+         this->data = nullptr;
+         this->count = 0;
+         this->capacity = 0;
+         return pData;
+     }
+
      Iterator begin()
      {
          return Iterator(this, 0);
@@ -79,9 +143,9 @@
       *  XArrayList<Point*> list(&XArrayList<Point*>::free);
       *  => Destructor will call free via function pointer "deleteUserData"
       */
-     static void free(XArrayList<T> *list)
+     static void free(XArrayList<T, Alloc> *list)
      {
-         typename XArrayList<T>::Iterator it = list->begin();
+         typename XArrayList<T, Alloc>::Iterator it = list->begin();
          while (it != list->end())
          {
              delete *it;
@@ -92,6 +156,16 @@
  protected:
      void checkIndex(int index);     // check validity of index for accessing
      void ensureCapacity(int index); // auto-allocate if needed
+     void makeRoom(int index, int size); // open "size" raw slots at index (count is not changed)
+     void moveGapTo(int index);
+     void closeGap();
+
+     /* physicalIndex: slot of data holding the item at "index"
+      */
+     int physicalIndex(int index) const
+     {
+         return (index < gapStart) ? index : index + gapSize;
+     }
  
      /** equals:
       * if T: primitive type:
@@ -118,7 +192,7 @@
              return itemEqual(lhs, rhs);
      }
  
-     void copyFrom(const XArrayList<T> &list);
+     void copyFrom(const XArrayList<T, Alloc> &list);
  
      void removeInternalData();
  
@@ -131,10 +205,10 @@
      {
      private:
          int cursor;
-         XArrayList<T> *pList;
+         XArrayList<T, Alloc> *pList;
  
      public:
-         Iterator(XArrayList<T> *pList = 0, int index = 0)
+         Iterator(XArrayList<T, Alloc> *pList = 0, int index = 0)
          {
              this->pList = pList;
              this->cursor = index;
@@ -147,15 +221,34 @@
          }
          void remove(void (*removeItemData)(T) = 0)
          {
-             T item = pList->removeAt(cursor);
+             /*
+              * The tail is not shifted here: the removed slot joins a gap that
+              * slides forward with the iterator (see XArrayList::closeGap).
+              * => removing k items in one forward pass costs O(n), not O(n*k)
+              */
+             pList->checkIndex(cursor);
+             if (pList->gapSize == 0)
+                 pList->gapStart = cursor;
+             else if (cursor < pList->gapStart)
+             {
+                 pList->closeGap();
+                 pList->gapStart = cursor;
+             }
+             else
+                 pList->moveGapTo(cursor);
+
+             T *pItem = &pList->data[cursor + pList->gapSize];
              if (removeItemData != 0)
-                 removeItemData(item);
+                 removeItemData(*pItem);
+             destroyRange(pItem, 0, 1);
+             pList->gapSize++;
+             pList->count--;
              cursor -= 1; // MUST keep index of previous, for ++ later
          }
- 
+
          T &operator*()
          {
-             return pList->data[cursor];
+             return pList->data[pList->physicalIndex(cursor)];
          }
          bool operator!=(const Iterator &iterator)
          {
@@ -182,9 +275,9 @@
  ////////////////////////     METHOD DEFNITION      ///////////////////
  //////////////////////////////////////////////////////////////////////
  
- template <class T>
- XArrayList<T>::XArrayList(
-     void (*deleteUserData)(XArrayList<T> *),
+ template <class T, class Alloc>
+ XArrayList<T, Alloc>::XArrayList(
+     void (*deleteUserData)(XArrayList<T, Alloc> *),
      bool (*itemEqual)(T &, T &),
      int capacity)
  {
@@ -193,11 +286,12 @@
      this->itemEqual = itemEqual;
      this->capacity = capacity;
      this->count = 0;
-     this->data = new T[capacity];
+     this->gapStart = this->gapSize = 0;
+     this->data = allocRaw<T, Alloc>(capacity);
  }
  
- template <class T>
- void XArrayList<T>::copyFrom(const XArrayList<T> &list)
+ template <class T, class Alloc>
+ void XArrayList<T, Alloc>::copyFrom(const XArrayList<T, Alloc> &list)
  {
      /*
       * Copies the contents of another XArrayList into this list.
@@ -208,19 +302,20 @@
  
      this->capacity = list.capacity;
      this->count = list.count;
- 
-     this->data = new T[capacity];
+     this->gapStart = this->gapSize = 0;
+
+     this->data = allocRaw<T, Alloc>(capacity);
      for (int i = 0; i < count; i++)
      {
-        this->data[i] = list.data[i];
+        new (&this->data[i]) T(list.data[list.physicalIndex(i)]);
      }
  
      this->deleteUserData = list.deleteUserData;
      this->itemEqual = list.itemEqual;
  }
  
- template <class T>
- void XArrayList<T>::removeInternalData()
+ template <class T, class Alloc>
+ void XArrayList<T, Alloc>::removeInternalData()
  {
      /*
       * Clears the internal data of the list by deleting the dynamic array and any user-defined data.
@@ -228,27 +323,29 @@
       * Finally, the dynamic array itself is deallocated from memory.
       */
      // TODO
+    closeGap();
     if (deleteUserData != nullptr)
     {
         deleteUserData(this);
     }
     if (this->data != nullptr) {
-        delete[] data;
+        destroyRange(this->data, 0, this->count);
+        freeRaw<T, Alloc>(this->data, this->capacity);
         this->data = nullptr;
     }
 
     this->count = 0;
 }
  
- template <class T>
- XArrayList<T>::XArrayList(const XArrayList<T> &list)
+ template <class T, class Alloc>
+ XArrayList<T, Alloc>::XArrayList(const XArrayList<T, Alloc> &list)
  {
      // TODO
      copyFrom(list);
  }
  
- template <class T>
- XArrayList<T> &XArrayList<T>::operator=(const XArrayList<T> &list)
+ template <class T, class Alloc>
+ XArrayList<T, Alloc> &XArrayList<T, Alloc>::operator=(const XArrayList<T, Alloc> &list)
  {
      // TODO
      if (this != &list)
@@ -259,24 +356,25 @@
      return *this;
  }
  
- template <class T>
- XArrayList<T>::~XArrayList()
+ template <class T, class Alloc>
+ XArrayList<T, Alloc>::~XArrayList()
  {
      // TODO
      removeInternalData();
  }
  
- template <class T>
- void XArrayList<T>::add(T e)
+ template <class T, class Alloc>
+ void XArrayList<T, Alloc>::add(T e)
  {
      // TODO
+     closeGap();
      ensureCapacity(this->count + 1);
-     this->data[this->count] = e;
+     new (&this->data[this->count]) T(std::move(e));
      this->count++;    
  }
  
- template <class T>
- void XArrayList<T>::add(int index, T e)
+ template <class T, class Alloc>
+ void XArrayList<T, Alloc>::add(int index, T e)
  {
     // TODO
     // cannot use checkIndex here because the range is [0, count]
@@ -288,36 +386,42 @@
         return;
     }
 
+    closeGap();
     ensureCapacity(this->count + 1);   
 
-    for (int i = this->count; i > index; i--) {
-        this->data[i] = this->data[i-1];
+    // the slot at count is raw memory: construct it, then shift the rest
+    new (&this->data[this->count]) T(std::move(this->data[this->count - 1]));
+    for (int i = this->count - 1; i > index; i--) {
+        this->data[i] = std::move(this->data[i-1]);
     }
 
-    this->data[index] = e;
+    this->data[index] = std::move(e);
     this->count++;
 
  }
  
- template <class T>
- T XArrayList<T>::removeAt(int index)
+ template <class T, class Alloc>
+ T XArrayList<T, Alloc>::removeAt(int index)
  {
      // TODO
      // If indexis invalid (out of range [0, count-1]), throw an exception
      checkIndex(index);
-     T item = this->data[index];
+     closeGap();
+     T item = std::move(this->data[index]);
      
     for (int i = index; i < this->count - 1; ++i) {
         data[i] = std::move(data[i + 1]);
       }
+     destroyRange(this->data, this->count - 1, this->count);
      this->count--;
      return item;
  }
  
- template <class T>
- bool XArrayList<T>::removeItem(T item, void (*removeItemData)(T))
+ template <class T, class Alloc>
+ bool XArrayList<T, Alloc>::removeItem(T item, void (*removeItemData)(T))
  {
      // TODO
+     closeGap();
      for (int i = 0; i < this->count; i++) {
          if (equals(this->data[i], item, this->itemEqual)) {
              if (removeItemData != nullptr) {
@@ -331,52 +435,56 @@
      return false;
  }
  
- template <class T>
- bool XArrayList<T>::empty()
+ template <class T, class Alloc>
+ bool XArrayList<T, Alloc>::empty()
  {
      // TODO
      return this->count == 0;
  }
  
- template <class T>
- int XArrayList<T>::size()
+ template <class T, class Alloc>
+ int XArrayList<T, Alloc>::size()
  {
      // TODO
      return this->count;
  }
  
- template <class T>
- void XArrayList<T>::clear()
+ template <class T, class Alloc>
+ void XArrayList<T, Alloc>::clear()
  {
      // TODO
      // Removes all elements in the list and resets the list to its initial state.
+     closeGap();
      if (deleteUserData != nullptr)
      {
          deleteUserData(this);
      } 
-     else  // if elements are objects that manage their own resources
-     {
-         for (int i = 0; i < count; ++i)
-         {
-            this->data[i].~T(); // Call the destructor for each element
-         }
-     }
+     // elements that manage their own resources are destroyed here;
+     // their slots become raw memory again
+     destroyRange(this->data, 0, this->count);
+    // keep the buffer (and its capacity) for reuse
     this->count = 0;
-    this->capacity = 10;
  }
  
- template <class T>
- T &XArrayList<T>::get(int index)
+ template <class T, class Alloc>
+ T &XArrayList<T, Alloc>::get(int index)
  {
      // TODO
      checkIndex(index);
-     return this->data[index];
+     return this->data[physicalIndex(index)];
  }
  
- template <class T>
- int XArrayList<T>::indexOf(T item)
+ template <class T, class Alloc>
+ int XArrayList<T, Alloc>::indexOf(T item)
  {
      // TODO
+     closeGap();
+     // arithmetic items compared by ==: vectorized scan (see util/SearchLib.h)
+     if constexpr (std::is_arithmetic<T>::value) {
+         if (this->itemEqual == nullptr) {
+             return findFirst(this->data, this->count, item);
+         }
+     }
      for (int i = 0; i < this->count; i++) {
          if (equals(this->data[i], item, this->itemEqual)) {
              return i;
@@ -385,15 +493,15 @@
  
      return -1;
  }
- template <class T>
- bool XArrayList<T>::contains(T item)
+ template <class T, class Alloc>
+ bool XArrayList<T, Alloc>::contains(T item)
  {
      // TODO
      return indexOf(item) != -1;
  }
  
- template <class T>
- string XArrayList<T>::toString(string (*item2str)(T &))
+ template <class T, class Alloc>
+ string XArrayList<T, Alloc>::toString(string (*item2str)(T &))
  {
      /**
       * Converts the array list into a string representation, formatting each element using a user-defined function.
@@ -405,6 +513,7 @@
       */
  
      // TODO
+     closeGap();
      stringstream ss;
      ss << "[";
      for (int i = 0; i < this->count; ++i)
@@ -437,11 +546,162 @@
      return ss.str();
  }
  
+ template <class T, class Alloc>
+ template <class InputIt>
+ void XArrayList<T, Alloc>::addAll(InputIt first, InputIt last)
+ {
+     // the length of an input range may be unknown: grow as add() does
+     closeGap();
+     for (; first != last; ++first)
+     {
+         ensureCapacity(this->count + 1);
+         new (&this->data[this->count]) T(*first);
+         this->count++;
+     }
+ }
+
+ template <class T, class Alloc>
+ void XArrayList<T, Alloc>::addAll(T array[], int size)
+ {
+     insertRange(this->count, array, size);
+ }
+
+ template <class T, class Alloc>
+ template <class InputIt>
+ void XArrayList<T, Alloc>::insertRange(int index, InputIt first, InputIt last)
+ {
+     if (index < 0 || index > this->count) {
+         throw out_of_range("Index is out of range!");
+     }
+     int size = 0;
+     for (InputIt it = first; it != last; ++it)
+         size++;
+
+     makeRoom(index, size);
+     for (int i = 0; i < size; i++, ++first)
+     {
+         new (&this->data[index + i]) T(*first);
+     }
+     this->count += size;
+ }
+
+ template <class T, class Alloc>
+ void XArrayList<T, Alloc>::insertRange(int index, T array[], int size)
+ {
+     if (index < 0 || index > this->count) {
+         throw out_of_range("Index is out of range!");
+     }
+     makeRoom(index, size);
+     for (int i = 0; i < size; i++)
+     {
+         new (&this->data[index + i]) T(array[i]);
+     }
+     this->count += size;
+ }
+
+ template <class T, class Alloc>
+ void XArrayList<T, Alloc>::removeRange(int from, int to)
+ {
+     if (from < 0 || to > this->count || from > to) {
+         throw out_of_range("Index is out of range!");
+     }
+     int size = to - from;
+     if (size == 0)
+         return;
+     closeGap();
+     for (int i = from; i < this->count - size; i++)
+     {
+         this->data[i] = std::move(this->data[i + size]);
+     }
+     destroyRange(this->data, this->count - size, this->count);
+     this->count -= size;
+ }
+
+ template <class T, class Alloc>
+ template <class Predicate>
+ int XArrayList<T, Alloc>::removeIf(Predicate pred, void (*removeItemData)(T))
+ {
+     // one pass: every kept item is moved down over the removed ones
+     closeGap();
+     int kept = 0;
+     for (int i = 0; i < this->count; i++)
+     {
+         if (pred(this->data[i]))
+         {
+             if (removeItemData != nullptr)
+                 removeItemData(this->data[i]);
+         }
+         else
+         {
+             if (kept != i)
+                 this->data[kept] = std::move(this->data[i]);
+             kept++;
+         }
+     }
+     int removed = this->count - kept;
+     destroyRange(this->data, kept, this->count);
+     this->count = kept;
+     return removed;
+ }
+
+ template <class T, class Alloc>
+ void XArrayList<T, Alloc>::sort()
+ {
+     closeGap();
+     pdqSort(this->data, this->count, [](T &lhs, T &rhs) { return lhs < rhs; });
+ }
+
+ template <class T, class Alloc>
+ template <class Comparator>
+ void XArrayList<T, Alloc>::sort(Comparator comparator)
+ {
+     closeGap();
+     pdqSort(this->data, this->count, [&comparator](T &lhs, T &rhs) { return comparator(lhs, rhs) < 0; });
+ }
+
+ template <class T, class Alloc>
+ void XArrayList<T, Alloc>::stableSort()
+ {
+     closeGap();
+     stableSortRange(this->data, this->count, [](T &lhs, T &rhs) { return lhs < rhs; });
+ }
+
+ template <class T, class Alloc>
+ template <class Comparator>
+ void XArrayList<T, Alloc>::stableSort(Comparator comparator)
+ {
+     closeGap();
+     stableSortRange(this->data, this->count, [&comparator](T &lhs, T &rhs) { return comparator(lhs, rhs) < 0; });
+ }
+
+ template <class T, class Alloc>
+ void XArrayList<T, Alloc>::parallelSort(int threads)
+ {
+     closeGap();
+     parallelSortRange(this->data, this->count, [](T &lhs, T &rhs) { return lhs < rhs; }, threads);
+ }
+
+ template <class T, class Alloc>
+ template <class Comparator, class>
+ void XArrayList<T, Alloc>::parallelSort(Comparator comparator, int threads)
+ {
+     closeGap();
+     parallelSortRange(this->data, this->count, [&comparator](T &lhs, T &rhs) { return comparator(lhs, rhs) < 0; }, threads);
+ }
+
+ template <class T, class Alloc>
+ template <class Func>
+ void XArrayList<T, Alloc>::parallelForEach(Func func, int threads)
+ {
+     closeGap();
+     parallelForRange(this->data, this->count, func, threads);
+ }
+
  //////////////////////////////////////////////////////////////////////
  //////////////////////// (private) METHOD DEFNITION //////////////////
  //////////////////////////////////////////////////////////////////////
- template <class T>
- void XArrayList<T>::checkIndex(int index)
+ template <class T, class Alloc>
+ void XArrayList<T, Alloc>::checkIndex(int index)
  {
      /**
       * Validates whether the given index is within the valid range of the list.
@@ -455,13 +715,14 @@
          throw out_of_range("Index is out of range!");
      }
  }
- template <class T>
- void XArrayList<T>::ensureCapacity(int index)
+ template <class T, class Alloc>
+ void XArrayList<T, Alloc>::ensureCapacity(int index)
  {
      /**
       * Ensures that the list has enough capacity to accommodate the given index.
       * If the index is out of range, it throws an std::out_of_range exception. If the index exceeds the current capacity,
-      * reallocates the internal array with increased capacity, copying the existing elements to the new array.
+      * reallocates the internal array with increased capacity, moving the existing elements to the new array
+      * (a single realloc when T is trivially copyable; new slots are never default-constructed).
       * In case of memory allocation failure, catches std::bad_alloc.
       */
      // TODO
@@ -472,15 +733,8 @@
         }
 
         try {
-            T *newData = new T[newCapacity];
-            // Copy elements properly instead of using memmove
-            for (int i = 0; i < this->count; i++) {
-                newData[i] = this->data[i];
-            }
-            T *oldData = this->data;
-            this->data = newData;
+            this->data = reallocRaw<T, Alloc>(this->data, this->count, this->capacity, newCapacity);
             this->capacity = newCapacity;
-            delete[] oldData;
         }
         catch (const std::bad_alloc &e) {
             throw e;
@@ -488,5 +742,60 @@
     }
 
  }
+
+ template <class T, class Alloc>
+ void XArrayList<T, Alloc>::makeRoom(int index, int size)
+ {
+     /**
+      * Moves the items [index, count) up by "size" in a single pass, so that
+      * data[index .. index+size-1] become raw slots for the caller to construct.
+      */
+     closeGap();
+     if (size <= 0)
+         return;
+     ensureCapacity(this->count + size);
+     for (int i = this->count - 1; i >= index; i--)
+     {
+         new (&this->data[i + size]) T(std::move(this->data[i]));
+         destroyRange(this->data, i, i + 1);
+     }
+ }
+
+ template <class T, class Alloc>
+ void XArrayList<T, Alloc>::moveGapTo(int index)
+ {
+     /**
+      * Slides the gap forward until it starts at "index" (index >= gapStart):
+      * the items in between are moved down by gapSize, each one exactly once.
+      */
+     if constexpr (std::is_trivially_copyable<T>::value)
+     {
+         if (index > gapStart)
+             memmove((void *)&this->data[gapStart], (void *)&this->data[gapStart + gapSize], (index - gapStart) * sizeof(T));
+     }
+     else
+     {
+         for (int i = gapStart; i < index; i++)
+         {
+             new (&this->data[i]) T(std::move(this->data[i + gapSize]));
+             destroyRange(this->data, i + gapSize, i + gapSize + 1);
+         }
+     }
+     gapStart = index;
+ }
+
+ template <class T, class Alloc>
+ void XArrayList<T, Alloc>::closeGap()
+ {
+     /**
+      * Iterator::remove leaves raw slots (a gap) instead of shifting the tail every time.
+      * Any operation other than get/size/empty/Iterator first calls closeGap, which moves
+      * the gap behind the last item, where it is ordinary spare capacity again.
+      */
+     if (gapSize == 0)
+         return;
+     moveGapTo(this->count);
+     gapStart = gapSize = 0;
+ }
  
  #endif /* XARRAYLIST_H */
\ No newline at end of file
@@ -0,0 +1 @@
+void heapBenchmark();
\ No newline at end of file
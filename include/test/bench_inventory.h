@@ -0,0 +1 @@
+void inventoryQueryBenchmark(int maxSize = 10000000);
\ No newline at end of file
@@ -0,0 +1,2 @@
+void xlistSearchBenchmark(int maxSize = 10000000);
+void xlistSortBenchmark(int maxSize = 10000000);
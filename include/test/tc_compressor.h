@@ -4,4 +4,5 @@ void tc_huffman1003();
 void tc_huffman1004();
 void tc_huffman1005();
 void tc_compressor1001();
-void tc_compressor1002();
\ No newline at end of file
+void tc_compressor1002();
+void tc_compressor1003();
\ No newline at end of file
@@ -4,3 +4,5 @@ void dlistDemo3();
 void dlistDemo4();
 void dlistDemo5();
 void dlistDemo6();
+void dlistDemo7();
+void dlistDemo8();
@@ -3,3 +3,12 @@ void tc_inventory1002();
 void tc_inventory1003();
 void tc_inventory1004();
 void tc_inventory1005();
+
+void tc_inventory1006();
+void tc_inventory1007();
+void tc_inventory1008();
+void tc_inventory1009();
+void tc_inventory1010();
+void tc_inventory1011();
+void tc_inventory1012();
+void tc_inventory1013();
\ No newline at end of file
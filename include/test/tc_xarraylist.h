@@ -1,4 +1,10 @@
 void xlistDemo1();
 void xlistDemo2();
 void xlistDemo3();
-void xlistDemo4();
\ No newline at end of file
+void xlistDemo4();
+void xlistDemo5();
+void xlistDemo6();
+void xlistDemo7();
+void xlistDemo8();
+void xlistDemo9();
+void xlistDemo10();
\ No newline at end of file
@@ -0,0 +1,266 @@
+#ifndef ALLOCATOR_H
+#define ALLOCATOR_H
+#include <cstdlib>
+#include <cstring>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+using namespace std;
+
+/*
+ * Allocators for the containers (XArrayList, DLinkedList, Heap, xMap): the last
+ * template parameter of each container, e.g.
+ *      XArrayList<int>                      // MallocAllocator: same as before
+ *      XArrayList<int, ArenaAllocator>      // memory from the current Arena
+ *      DLinkedList<Point*, PoolAllocator>   // nodes from per-thread free lists
+ *
+ * An allocator is a type with static members only (containers stay the same size):
+ *      static void* allocate(size_t bytes);
+ *      static void  deallocate(void* ptr, size_t bytes);   // bytes: as passed to allocate
+ *      static void* reallocate(void* ptr, size_t oldBytes, size_t newBytes);
+ *                   // for trivially copyable items only: may move the bytes
+ * allocate throws std::bad_alloc on failure. Memory is aligned for any scalar type.
+ */
+
+//////////////////////////////////////////////////////////////////////
+/////////////////////////  MallocAllocator  //////////////////////////
+//////////////////////////////////////////////////////////////////////
+struct MallocAllocator{
+    static void* allocate(size_t bytes){
+        void* memory = std::malloc(bytes > 0 ? bytes : 1);
+        if(memory == nullptr) throw std::bad_alloc();
+        return memory;
+    }
+    static void deallocate(void* ptr, size_t bytes){
+        (void)bytes;
+        std::free(ptr);
+    }
+    static void* reallocate(void* ptr, size_t oldBytes, size_t newBytes){
+        (void)oldBytes;
+        void* memory = std::realloc(ptr, newBytes > 0 ? newBytes : 1);
+        if(memory == nullptr) throw std::bad_alloc();
+        return memory;
+    }
+};
+
+//////////////////////////////////////////////////////////////////////
+/////////////////////////  Arena  ////////////////////////////////////
+//////////////////////////////////////////////////////////////////////
+/*
+ * Arena: bump-pointer allocator. Memory is handed out from big blocks and is
+ * only given back all at once, by release() or by the destructor.
+ *
+ * ArenaAllocator allocates from the Arena made current (on this thread) by an ArenaScope:
+ *      Arena arena;
+ *      {
+ *          ArenaScope scope(arena);
+ *          XArrayList<int, ArenaAllocator> ids;
+ *          xMap<int, int, ArenaAllocator> counts(&hashFunc);
+ *          ...                             // all allocations come from "arena"
+ *      }                                   // containers destroyed: deallocate is a no-op
+ *      arena.release();                    // everything freed in one step
+ *
+ *  + release the arena only AFTER the containers using it are destroyed
+ *  + a container must not grow when no ArenaScope is active (std::logic_error)
+ */
+class Arena{
+public:
+    Arena(size_t blockSize = 64 * 1024){
+        this->blockSize = (blockSize > 0) ? blockSize : 1024;
+        this->blocks = nullptr;
+        this->cursor = this->limit = nullptr;
+        this->lastAllocation = nullptr;
+        this->used = 0;
+    }
+    ~Arena(){
+        release();
+    }
+
+    void* allocate(size_t bytes){
+        bytes = alignUp(bytes > 0 ? bytes : 1);
+        if(cursor == nullptr || (size_t)(limit - cursor) < bytes){
+            addBlock(bytes);
+        }
+        void* memory = cursor;
+        cursor += bytes;
+        used += bytes;
+        lastAllocation = (char*)memory;
+        return memory;
+    }
+    /* reallocate: grows in place when ptr is the most recent allocation and the block has room
+     */
+    void* reallocate(void* ptr, size_t oldBytes, size_t newBytes){
+        if(ptr != nullptr && (char*)ptr == lastAllocation){
+            size_t oldSize = alignUp(oldBytes > 0 ? oldBytes : 1);
+            size_t newSize = alignUp(newBytes > 0 ? newBytes : 1);
+            if(newSize <= oldSize || (size_t)(limit - lastAllocation) >= newSize){
+                cursor = lastAllocation + newSize;
+                used = used - oldSize + newSize;
+                return ptr;
+            }
+        }
+        void* memory = allocate(newBytes);
+        if(ptr != nullptr) std::memcpy(memory, ptr, (oldBytes < newBytes) ? oldBytes : newBytes);
+        return memory;
+    }
+    /* release: free every block; all memory handed out by this arena becomes invalid
+     */
+    void release(){
+        while(blocks != nullptr){
+            Block* next = blocks->next;
+            std::free(blocks);
+            blocks = next;
+        }
+        cursor = limit = nullptr;
+        lastAllocation = nullptr;
+        used = 0;
+    }
+    size_t bytesUsed(){
+        return used;
+    }
+
+private:
+    struct Block{
+        Block* next;
+        size_t size;
+    };
+    static const size_t ALIGNMENT = alignof(std::max_align_t);
+
+    Block* blocks;          // most recent block first
+    char* cursor;           // next free byte in the current block
+    char* limit;            // end of the current block
+    char* lastAllocation;   // for reallocate
+    size_t blockSize;
+    size_t used;
+
+    static size_t alignUp(size_t bytes){
+        return (bytes + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+    }
+    void addBlock(size_t bytes){
+        size_t header = alignUp(sizeof(Block));
+        size_t size = (bytes + header > blockSize) ? bytes + header : blockSize;
+        Block* block = (Block*)std::malloc(size);
+        if(block == nullptr) throw std::bad_alloc();
+        block->next = blocks;
+        block->size = size;
+        blocks = block;
+        cursor = (char*)block + header;
+        limit = (char*)block + size;
+    }
+
+    Arena(const Arena&);            // not copyable
+    Arena& operator=(const Arena&);
+};
+
+struct ArenaAllocator{
+    static Arena*& current(){
+        static thread_local Arena* arena = nullptr;
+        return arena;
+    }
+    static void* allocate(size_t bytes){
+        Arena* arena = current();
+        if(arena == nullptr) throw std::logic_error("ArenaAllocator: no active ArenaScope");
+        return arena->allocate(bytes);
+    }
+    static void deallocate(void* ptr, size_t bytes){
+        // freed with the arena
+        (void)ptr;
+        (void)bytes;
+    }
+    static void* reallocate(void* ptr, size_t oldBytes, size_t newBytes){
+        Arena* arena = current();
+        if(arena == nullptr) throw std::logic_error("ArenaAllocator: no active ArenaScope");
+        return arena->reallocate(ptr, oldBytes, newBytes);
+    }
+};
+
+/* ArenaScope: makes "arena" the current one of this thread until the end of the scope
+ */
+class ArenaScope{
+public:
+    ArenaScope(Arena& arena){
+        previous = ArenaAllocator::current();
+        ArenaAllocator::current() = &arena;
+    }
+    ~ArenaScope(){
+        ArenaAllocator::current() = previous;
+    }
+private:
+    Arena* previous;
+    ArenaScope(const ArenaScope&);
+    ArenaScope& operator=(const ArenaScope&);
+};
+
+//////////////////////////////////////////////////////////////////////
+/////////////////////////  PoolAllocator  ////////////////////////////
+//////////////////////////////////////////////////////////////////////
+/*
+ * PoolAllocator: small blocks (<= 256 bytes, e.g. list nodes, map entries) come from
+ * per-thread free lists, one per size class of 16 bytes; bigger blocks use malloc.
+ *  + no lock: each thread has its own lists; a block freed by another thread
+ *      simply joins that thread's list
+ *  + the slabs the blocks are cut from are kept for the whole program and reused
+ */
+struct PoolAllocator{
+    static const size_t GRANULARITY = 16;
+    static const size_t MAX_POOLED = 256;
+    static const size_t SLAB_SIZE = 64 * 1024;
+
+    static void* allocate(size_t bytes){
+        if(bytes > MAX_POOLED) return MallocAllocator::allocate(bytes);
+        FreeBlock*& head = freeList(bytes);
+        if(head == nullptr) refill(head, sizeClass(bytes));
+        FreeBlock* block = head;
+        head = block->next;
+        return block;
+    }
+    static void deallocate(void* ptr, size_t bytes){
+        if(ptr == nullptr) return;
+        if(bytes > MAX_POOLED){
+            MallocAllocator::deallocate(ptr, bytes);
+            return;
+        }
+        FreeBlock*& head = freeList(bytes);
+        FreeBlock* block = (FreeBlock*)ptr;
+        block->next = head;
+        head = block;
+    }
+    static void* reallocate(void* ptr, size_t oldBytes, size_t newBytes){
+        if(oldBytes > MAX_POOLED && newBytes > MAX_POOLED){
+            return MallocAllocator::reallocate(ptr, oldBytes, newBytes);
+        }
+        if(ptr != nullptr && oldBytes <= MAX_POOLED && newBytes <= MAX_POOLED
+           && sizeClass(oldBytes) == sizeClass(newBytes)){
+            return ptr;
+        }
+        void* memory = allocate(newBytes);
+        if(ptr != nullptr){
+            std::memcpy(memory, ptr, (oldBytes < newBytes) ? oldBytes : newBytes);
+            deallocate(ptr, oldBytes);
+        }
+        return memory;
+    }
+
+private:
+    struct FreeBlock{
+        FreeBlock* next;
+    };
+    static size_t sizeClass(size_t bytes){
+        return (bytes > 0) ? (bytes - 1) / GRANULARITY : 0; // 0: [1, 16], 1: [17, 32], ...
+    }
+    static FreeBlock*& freeList(size_t bytes){
+        static thread_local FreeBlock* heads[MAX_POOLED / GRANULARITY] = {};
+        return heads[sizeClass(bytes)];
+    }
+    static void refill(FreeBlock*& head, size_t cls){
+        size_t blockBytes = (cls + 1) * GRANULARITY;
+        char* slab = (char*)MallocAllocator::allocate(SLAB_SIZE);
+        for(size_t offset = 0; offset + blockBytes <= SLAB_SIZE; offset += blockBytes){
+            FreeBlock* block = (FreeBlock*)(slab + offset);
+            block->next = head;
+            head = block;
+        }
+    }
+};
+
+#endif /* ALLOCATOR_H */
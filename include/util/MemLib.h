@@ -0,0 +1,64 @@
+#ifndef MEMLIB_H
+#define MEMLIB_H
+#include <cstdlib>
+#include <new>
+#include <utility>
+#include <type_traits>
+#include "util/Allocator.h"
+using namespace std;
+
+/*
+ * Helpers for containers that keep a buffer of "capacity" slots where only the
+ * first "count" slots hold live objects (XArrayList, Heap):
+ *  + slots in [count, capacity) are raw memory: NO default constructor is run
+ *  + a live slot is created with placement-new and ended with destroyRange
+ *  + growing a buffer MOVES the live objects into the new one; for trivially
+ *    copyable T, it is a single realloc (no per-element work at all)
+ *
+ * A buffer returned by allocRaw/reallocRaw MUST be released by freeRaw
+ * (never by delete[]), with the same allocator (see util/Allocator.h) and capacity.
+ */
+
+template<class T, class Alloc = MallocAllocator>
+T* allocRaw(int capacity){
+    if(capacity <= 0) return nullptr;
+    return static_cast<T*>(Alloc::allocate(sizeof(T) * (size_t)capacity));
+}
+
+template<class T, class Alloc = MallocAllocator>
+void freeRaw(T* data, int capacity){
+    if(data == nullptr) return;
+    Alloc::deallocate(data, sizeof(T) * (size_t)capacity);
+}
+
+template<class T>
+void destroyRange(T* data, int from, int to){
+    if constexpr (!std::is_trivially_destructible<T>::value){
+        for(int idx = from; idx < to; idx++) data[idx].~T();
+    }
+}
+
+/*
+ * reallocRaw(data, count, capacity, newCapacity):
+ *  return a buffer of newCapacity slots holding the "count" live objects of data
+ *  (a buffer of "capacity" slots); data is released (do not use it afterwards)
+ */
+template<class T, class Alloc = MallocAllocator>
+T* reallocRaw(T* data, int count, int capacity, int newCapacity){
+    if constexpr (std::is_trivially_copyable<T>::value){
+        if(data == nullptr) return allocRaw<T, Alloc>(newCapacity);
+        void* memory = Alloc::reallocate(data, sizeof(T) * (size_t)capacity, sizeof(T) * (size_t)newCapacity);
+        return static_cast<T*>(memory);
+    }
+    else{
+        T* newData = allocRaw<T, Alloc>(newCapacity);
+        for(int idx = 0; idx < count; idx++){
+            new (&newData[idx]) T(std::move(data[idx]));
+        }
+        destroyRange(data, 0, count);
+        freeRaw<T, Alloc>(data, capacity);
+        return newData;
+    }
+}
+
+#endif /* MEMLIB_H */
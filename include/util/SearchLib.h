@@ -0,0 +1,205 @@
+#ifndef SEARCHLIB_H
+#define SEARCHLIB_H
+#include <type_traits>
+using namespace std;
+
+/*
+ * findFirst(data, count, value): index of the first item equal (==) to value
+ * in data[0..count-1], or -1.
+ *
+ *  + int, float, double, char: vectorized kernels
+ *      - AVX2 when the compiler targets it (-mavx2 / -march=native), or when
+ *        the CPU reports it at runtime (GCC/Clang on x86, checked once)
+ *      - SSE2 otherwise (always available on x86-64)
+ *  + any other T (or another compiler/CPU): the plain scalar loop
+ *
+ * Equality is the one of operator ==, lane by lane (NaN never matches,
+ * -0.0 matches 0.0), so the result is always the same as the scalar loop.
+ */
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SEARCHLIB_SSE2 1
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SEARCHLIB_AVX2 1
+#define SEARCHLIB_AVX2_TARGET
+#define SEARCHLIB_HAS_AVX2() true
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define SEARCHLIB_AVX2 1
+#define SEARCHLIB_AVX2_TARGET __attribute__((target("avx2")))
+inline bool searchLibCpuHasAvx2(){
+    static const bool hasAvx2 = __builtin_cpu_supports("avx2");
+    return hasAvx2;
+}
+#define SEARCHLIB_HAS_AVX2() searchLibCpuHasAvx2()
+#endif
+
+template<class T>
+int findFirst(const T* data, int count, const T& value){
+    for(int idx = 0; idx < count; idx++){
+        if(data[idx] == value) return idx;
+    }
+    return -1;
+}
+
+/*
+ * Every kernel below has the same shape:
+ *  - compare LANES items at a time and turn the lanes into a bit mask
+ *  - the first set bit of the first non-zero mask is the answer
+ *  - the last (count % LANES) items go through the scalar loop
+ */
+inline int searchLibFirstBit(unsigned int mask){
+#if defined(__GNUC__)
+    return __builtin_ctz(mask);
+#else
+    int bit = 0;
+    while((mask & 1u) == 0){
+        mask >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+#ifdef SEARCHLIB_AVX2
+SEARCHLIB_AVX2_TARGET
+inline int findFirstAvx2(const int* data, int count, int value){
+    const __m256i needle = _mm256_set1_epi32(value);
+    int idx = 0;
+    for(; idx + 8 <= count; idx += 8){
+        __m256i block = _mm256_loadu_si256((const __m256i*)(data + idx));
+        unsigned int mask = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needle)));
+        if(mask != 0) return idx + searchLibFirstBit(mask);
+    }
+    int found = findFirst(data + idx, count - idx, value);
+    return (found < 0) ? -1 : idx + found;
+}
+
+SEARCHLIB_AVX2_TARGET
+inline int findFirstAvx2(const float* data, int count, float value){
+    const __m256 needle = _mm256_set1_ps(value);
+    int idx = 0;
+    for(; idx + 8 <= count; idx += 8){
+        __m256 block = _mm256_loadu_ps(data + idx);
+        unsigned int mask = (unsigned int)_mm256_movemask_ps(_mm256_cmp_ps(block, needle, _CMP_EQ_OQ));
+        if(mask != 0) return idx + searchLibFirstBit(mask);
+    }
+    int found = findFirst(data + idx, count - idx, value);
+    return (found < 0) ? -1 : idx + found;
+}
+
+SEARCHLIB_AVX2_TARGET
+inline int findFirstAvx2(const double* data, int count, double value){
+    const __m256d needle = _mm256_set1_pd(value);
+    int idx = 0;
+    for(; idx + 4 <= count; idx += 4){
+        __m256d block = _mm256_loadu_pd(data + idx);
+        unsigned int mask = (unsigned int)_mm256_movemask_pd(_mm256_cmp_pd(block, needle, _CMP_EQ_OQ));
+        if(mask != 0) return idx + searchLibFirstBit(mask);
+    }
+    int found = findFirst(data + idx, count - idx, value);
+    return (found < 0) ? -1 : idx + found;
+}
+
+SEARCHLIB_AVX2_TARGET
+inline int findFirstAvx2(const char* data, int count, char value){
+    const __m256i needle = _mm256_set1_epi8(value);
+    int idx = 0;
+    for(; idx + 32 <= count; idx += 32){
+        __m256i block = _mm256_loadu_si256((const __m256i*)(data + idx));
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle));
+        if(mask != 0) return idx + searchLibFirstBit(mask);
+    }
+    int found = findFirst(data + idx, count - idx, value);
+    return (found < 0) ? -1 : idx + found;
+}
+#endif /* SEARCHLIB_AVX2 */
+
+#ifdef SEARCHLIB_SSE2
+inline int findFirstSse2(const int* data, int count, int value){
+    const __m128i needle = _mm_set1_epi32(value);
+    int idx = 0;
+    for(; idx + 4 <= count; idx += 4){
+        __m128i block = _mm_loadu_si128((const __m128i*)(data + idx));
+        unsigned int mask = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle)));
+        if(mask != 0) return idx + searchLibFirstBit(mask);
+    }
+    int found = findFirst(data + idx, count - idx, value);
+    return (found < 0) ? -1 : idx + found;
+}
+
+inline int findFirstSse2(const float* data, int count, float value){
+    const __m128 needle = _mm_set1_ps(value);
+    int idx = 0;
+    for(; idx + 4 <= count; idx += 4){
+        __m128 block = _mm_loadu_ps(data + idx);
+        unsigned int mask = (unsigned int)_mm_movemask_ps(_mm_cmpeq_ps(block, needle));
+        if(mask != 0) return idx + searchLibFirstBit(mask);
+    }
+    int found = findFirst(data + idx, count - idx, value);
+    return (found < 0) ? -1 : idx + found;
+}
+
+inline int findFirstSse2(const double* data, int count, double value){
+    const __m128d needle = _mm_set1_pd(value);
+    int idx = 0;
+    for(; idx + 2 <= count; idx += 2){
+        __m128d block = _mm_loadu_pd(data + idx);
+        unsigned int mask = (unsigned int)_mm_movemask_pd(_mm_cmpeq_pd(block, needle));
+        if(mask != 0) return idx + searchLibFirstBit(mask);
+    }
+    int found = findFirst(data + idx, count - idx, value);
+    return (found < 0) ? -1 : idx + found;
+}
+
+inline int findFirstSse2(const char* data, int count, char value){
+    const __m128i needle = _mm_set1_epi8(value);
+    int idx = 0;
+    for(; idx + 16 <= count; idx += 16){
+        __m128i block = _mm_loadu_si128((const __m128i*)(data + idx));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle));
+        if(mask != 0) return idx + searchLibFirstBit(mask);
+    }
+    int found = findFirst(data + idx, count - idx, value);
+    return (found < 0) ? -1 : idx + found;
+}
+#endif /* SEARCHLIB_SSE2 */
+
+/*
+ * Overloads picked (at compile time) instead of the template above.
+ * Short arrays are not worth the dispatch: they take the scalar loop.
+ */
+#if defined(SEARCHLIB_AVX2) && defined(SEARCHLIB_SSE2)
+#define SEARCHLIB_DISPATCH(T, data, count, value)                       \
+    if(count < 16) return findFirst<T>(data, count, value);             \
+    if(SEARCHLIB_HAS_AVX2()) return findFirstAvx2(data, count, value);  \
+    return findFirstSse2(data, count, value);
+#elif defined(SEARCHLIB_SSE2)
+#define SEARCHLIB_DISPATCH(T, data, count, value)                       \
+    if(count < 16) return findFirst<T>(data, count, value);             \
+    return findFirstSse2(data, count, value);
+#else
+#define SEARCHLIB_DISPATCH(T, data, count, value)                       \
+    return findFirst<T>(data, count, value);
+#endif
+
+inline int findFirst(const int* data, int count, const int& value){
+    SEARCHLIB_DISPATCH(int, data, count, value)
+}
+inline int findFirst(const float* data, int count, const float& value){
+    SEARCHLIB_DISPATCH(float, data, count, value)
+}
+inline int findFirst(const double* data, int count, const double& value){
+    SEARCHLIB_DISPATCH(double, data, count, value)
+}
+inline int findFirst(const char* data, int count, const char& value){
+    SEARCHLIB_DISPATCH(char, data, count, value)
+}
+
+#undef SEARCHLIB_DISPATCH
+
+#endif /* SEARCHLIB_H */
@@ -0,0 +1,424 @@
+#ifndef SORTLIB_H
+#define SORTLIB_H
+#include <algorithm>
+#include <thread>
+#include <utility>
+#include "util/MemLib.h"
+using namespace std;
+
+/*
+ * Sorting kernels on raw arrays (used by XArrayList::sort, stableSort, parallelSort).
+ * "less" is any callable: bool less(T& a, T& b), true if a must come before b.
+ *
+ *  + pdqSort(data, n, less): pattern-defeating quicksort, O(n log n) worst case,
+ *      O(n) on sorted, reversed and "few distinct keys" inputs; NOT stable
+ *  + stableSortRange(data, n, less): bottom-up merge sort with an n-item buffer; stable
+ *  + parallelSortRange(data, n, less, threads): every thread pdq-sorts one chunk,
+ *      then the chunks are merged pairwise; each merge round is split between all
+ *      threads (merge path), so no round is left to a single thread; NOT stable
+ *  + parallelForRange(data, n, func, threads): func(data[i]) for every i, one
+ *      contiguous chunk per thread
+ *
+ * threads <= 0 means one per hardware thread. "less" and "func" must not throw
+ * when they run on a worker thread.
+ */
+
+inline int sortLibThreadCount(int threads){
+    if(threads > 0) return threads;
+    int hardware = (int)std::thread::hardware_concurrency();
+    return (hardware > 0) ? hardware : 1;
+}
+
+/* runParallel(threads, task): task(id) for id in [0, threads); id 0 runs on the caller
+ */
+template<class Task>
+void runParallel(int threads, Task task){
+    if(threads <= 1){
+        task(0);
+        return;
+    }
+    std::thread* workers = new std::thread[threads - 1];
+    for(int id = 1; id < threads; id++) workers[id - 1] = std::thread(task, id);
+    task(0);
+    for(int id = 1; id < threads; id++) workers[id - 1].join();
+    delete[] workers;
+}
+
+//////////////////////////////////////////////////////////////////////
+/////////////////////////////  pdqSort  //////////////////////////////
+//////////////////////////////////////////////////////////////////////
+enum {
+    PDQ_INSERTION_SORT_THRESHOLD = 24,      // smaller ranges: insertion sort
+    PDQ_NINTHER_THRESHOLD = 128,            // larger ranges: pivot = median of 3 medians
+    PDQ_PARTIAL_INSERTION_SORT_LIMIT = 8    // moves allowed before giving up on "almost sorted"
+};
+
+template<class T, class Less>
+void insertionSortRange(T* begin, T* end, Less& less){
+    if(begin == end) return;
+    for(T* cur = begin + 1; cur != end; cur++){
+        if(less(*cur, *(cur - 1))){
+            T item(std::move(*cur));
+            T* sift = cur;
+            do{
+                *sift = std::move(*(sift - 1));
+                sift--;
+            } while(sift != begin && less(item, *(sift - 1)));
+            *sift = std::move(item);
+        }
+    }
+}
+
+/* pdqPartialInsertionSort: insertion sort that gives up (returns false) after a few moves
+ */
+template<class T, class Less>
+bool pdqPartialInsertionSort(T* begin, T* end, Less& less){
+    if(begin == end) return true;
+    int moves = 0;
+    for(T* cur = begin + 1; cur != end; cur++){
+        if(less(*cur, *(cur - 1))){
+            T item(std::move(*cur));
+            T* sift = cur;
+            do{
+                *sift = std::move(*(sift - 1));
+                sift--;
+            } while(sift != begin && less(item, *(sift - 1)));
+            *sift = std::move(item);
+            moves += (int)(cur - sift);
+        }
+        if(moves > PDQ_PARTIAL_INSERTION_SORT_LIMIT) return false;
+    }
+    return true;
+}
+
+template<class T, class Less>
+void pdqSort2(T* a, T* b, Less& less){
+    if(less(*b, *a)) std::swap(*a, *b);
+}
+
+template<class T, class Less>
+void pdqSort3(T* a, T* b, T* c, Less& less){
+    pdqSort2(a, b, less);
+    pdqSort2(b, c, less);
+    pdqSort2(a, b, less);
+}
+
+/*
+ * pdqPartitionRight: partition around *begin; items equal to the pivot go right.
+ * Return the final position of the pivot; "alreadyPartitioned" is true if no swap was needed.
+ * A median-of-3 pivot guarantees an item >= pivot on its right: the scans need no bound check.
+ */
+template<class T, class Less>
+T* pdqPartitionRight(T* begin, T* end, Less& less, bool& alreadyPartitioned){
+    T pivot(std::move(*begin));
+    T* first = begin;
+    T* last = end;
+
+    while(less(*++first, pivot));
+    if(first - 1 == begin){
+        while(first < last && !less(*--last, pivot));
+    }
+    else{
+        while(!less(*--last, pivot));
+    }
+
+    alreadyPartitioned = first >= last;
+    while(first < last){
+        std::swap(*first, *last);
+        while(less(*++first, pivot));
+        while(!less(*--last, pivot));
+    }
+
+    T* pivotPos = first - 1;
+    *begin = std::move(*pivotPos);
+    *pivotPos = std::move(pivot);
+    return pivotPos;
+}
+
+/*
+ * pdqPartitionLeft: same, but items equal to the pivot go left. Used when the pivot
+ * equals the item just before the range: then the whole left part is equal to the
+ * pivot and is already in place (many duplicates => linear time).
+ */
+template<class T, class Less>
+T* pdqPartitionLeft(T* begin, T* end, Less& less){
+    T pivot(std::move(*begin));
+    T* first = begin;
+    T* last = end;
+
+    while(less(pivot, *--last));
+    if(last + 1 == end){
+        while(first < last && !less(pivot, *++first));
+    }
+    else{
+        while(!less(pivot, *++first));
+    }
+
+    while(first < last){
+        std::swap(*first, *last);
+        while(less(pivot, *--last));
+        while(!less(pivot, *++first));
+    }
+
+    T* pivotPos = last;
+    *begin = std::move(*pivotPos);
+    *pivotPos = std::move(pivot);
+    return pivotPos;
+}
+
+template<class T, class Less>
+void pdqSortLoop(T* begin, T* end, Less& less, int badAllowed, bool leftmost){
+    while(true){
+        int size = (int)(end - begin);
+        if(size < PDQ_INSERTION_SORT_THRESHOLD){
+            insertionSortRange(begin, end, less);
+            return;
+        }
+
+        // move the pivot to *begin
+        int half = size / 2;
+        if(size > PDQ_NINTHER_THRESHOLD){
+            pdqSort3(begin, begin + half, end - 1, less);
+            pdqSort3(begin + 1, begin + (half - 1), end - 2, less);
+            pdqSort3(begin + 2, begin + (half + 1), end - 3, less);
+            pdqSort3(begin + (half - 1), begin + half, begin + (half + 1), less);
+            std::swap(*begin, *(begin + half));
+        }
+        else{
+            pdqSort3(begin + half, begin, end - 1, less);
+        }
+
+        // *(begin - 1) is the pivot of an earlier partition: nothing here is smaller
+        if(!leftmost && !less(*(begin - 1), *begin)){
+            begin = pdqPartitionLeft(begin, end, less) + 1;
+            continue;
+        }
+
+        bool alreadyPartitioned = false;
+        T* pivotPos = pdqPartitionRight(begin, end, less, alreadyPartitioned);
+
+        int leftSize = (int)(pivotPos - begin);
+        int rightSize = (int)(end - (pivotPos + 1));
+        bool highlyUnbalanced = leftSize < size / 8 || rightSize < size / 8;
+
+        if(highlyUnbalanced){
+            // too many bad pivots: switch to heapsort (keeps the O(n log n) bound)
+            if(--badAllowed == 0){
+                std::make_heap(begin, end, less);
+                std::sort_heap(begin, end, less);
+                return;
+            }
+            // otherwise shuffle a few items to break the pattern that caused it
+            if(leftSize >= PDQ_INSERTION_SORT_THRESHOLD){
+                std::swap(*begin, *(begin + leftSize / 4));
+                std::swap(*(pivotPos - 1), *(pivotPos - leftSize / 4));
+                if(leftSize > PDQ_NINTHER_THRESHOLD){
+                    std::swap(*(begin + 1), *(begin + (leftSize / 4 + 1)));
+                    std::swap(*(begin + 2), *(begin + (leftSize / 4 + 2)));
+                    std::swap(*(pivotPos - 2), *(pivotPos - (leftSize / 4 + 1)));
+                    std::swap(*(pivotPos - 3), *(pivotPos - (leftSize / 4 + 2)));
+                }
+            }
+            if(rightSize >= PDQ_INSERTION_SORT_THRESHOLD){
+                std::swap(*(pivotPos + 1), *(pivotPos + (1 + rightSize / 4)));
+                std::swap(*(end - 1), *(end - rightSize / 4));
+                if(rightSize > PDQ_NINTHER_THRESHOLD){
+                    std::swap(*(pivotPos + 2), *(pivotPos + (2 + rightSize / 4)));
+                    std::swap(*(pivotPos + 3), *(pivotPos + (3 + rightSize / 4)));
+                    std::swap(*(end - 2), *(end - (1 + rightSize / 4)));
+                    std::swap(*(end - 3), *(end - (2 + rightSize / 4)));
+                }
+            }
+        }
+        else if(alreadyPartitioned
+                && pdqPartialInsertionSort(begin, pivotPos, less)
+                && pdqPartialInsertionSort(pivotPos + 1, end, less)){
+            // a balanced partition that needed no swap: probably (almost) sorted
+            return;
+        }
+
+        // recurse on the left part, loop on the right part
+        pdqSortLoop(begin, pivotPos, less, badAllowed, leftmost);
+        begin = pivotPos + 1;
+        leftmost = false;
+    }
+}
+
+template<class T, class Less>
+void pdqSort(T* data, int n, Less less){
+    if(n < 2) return;
+    int log2n = 0;
+    while((1 << log2n) <= n / 2 && log2n < 30) log2n++;
+    pdqSortLoop(data, data + n, less, log2n + 1, true);
+}
+
+//////////////////////////////////////////////////////////////////////
+/////////////////////////  stable merge sort  ////////////////////////
+//////////////////////////////////////////////////////////////////////
+
+/* mergeRuns: stable merge of a[0..na) and b[0..nb) into out (live items, move-assigned)
+ */
+template<class T, class Less>
+void mergeRuns(T* a, int na, T* b, int nb, T* out, Less& less){
+    int i = 0, j = 0, k = 0;
+    while(i < na && j < nb){
+        if(less(b[j], a[i])) out[k++] = std::move(b[j++]);
+        else out[k++] = std::move(a[i++]);
+    }
+    while(i < na) out[k++] = std::move(a[i++]);
+    while(j < nb) out[k++] = std::move(b[j++]);
+}
+
+/* mergeSplit: number of items of a taken by the first "k" outputs of mergeRuns(a, b)
+ */
+template<class T, class Less>
+int mergeSplit(T* a, int na, T* b, int nb, int k, Less& less){
+    int lo = (k > nb) ? k - nb : 0;
+    int hi = (k < na) ? k : na;
+    while(lo < hi){
+        int i = lo + (hi - lo) / 2;
+        int j = k - i;
+        // a[i] is output before b[j-1]: the first k outputs take more of a
+        if(j > 0 && !less(b[j - 1], a[i])) lo = i + 1;
+        else hi = i;
+    }
+    return lo;
+}
+
+template<class T, class Less>
+void stableSortRange(T* data, int n, Less less){
+    const int RUN = 32;
+    if(n <= RUN){
+        insertionSortRange(data, data + n, less);
+        return;
+    }
+    for(int from = 0; from < n; from += RUN){
+        insertionSortRange(data + from, data + std::min(from + RUN, n), less);
+    }
+
+    // the buffer holds live (moved-from) items, so every merge is a move-assignment
+    T* buffer = allocRaw<T>(n);
+    for(int idx = 0; idx < n; idx++) new (&buffer[idx]) T(std::move(data[idx]));
+
+    T* src = buffer;
+    T* dst = data;
+    for(int width = RUN; width < n; width *= 2){
+        for(int from = 0; from < n; from += 2 * width){
+            int mid = std::min(from + width, n);
+            int to = std::min(from + 2 * width, n);
+            mergeRuns(src + from, mid - from, src + mid, to - mid, dst + from, less);
+        }
+        std::swap(src, dst);
+    }
+    if(src != data){
+        for(int idx = 0; idx < n; idx++) data[idx] = std::move(src[idx]);
+    }
+
+    destroyRange(buffer, 0, n);
+    freeRaw(buffer, n);
+}
+
+//////////////////////////////////////////////////////////////////////
+/////////////////////////  parallel sort  ////////////////////////////
+//////////////////////////////////////////////////////////////////////
+
+template<class T, class Less>
+void parallelSortRange(T* data, int n, Less less, int threads){
+    const int PARALLEL_SORT_CUTOFF = 1 << 16; // below this, threads cost more than they save
+    threads = sortLibThreadCount(threads);
+    if(threads > n / (PARALLEL_SORT_CUTOFF / 4)) threads = n / (PARALLEL_SORT_CUTOFF / 4);
+    if(threads <= 1 || n < PARALLEL_SORT_CUTOFF){
+        pdqSort(data, n, less);
+        return;
+    }
+
+    // runs[r] .. runs[r+1]: r-th sorted run
+    int numRuns = threads;
+    int* runs = new int[numRuns + 1];
+    for(int r = 0; r <= numRuns; r++) runs[r] = (int)((long long)n * r / numRuns);
+
+    // 1. sort one chunk per thread, then move it to the buffer (which thus becomes live)
+    T* buffer = allocRaw<T>(n);
+    runParallel(threads, [&](int id){
+        pdqSort(data + runs[id], runs[id + 1] - runs[id], less);
+        for(int idx = runs[id]; idx < runs[id + 1]; idx++) new (&buffer[idx]) T(std::move(data[idx]));
+    });
+
+    // 2. merge pairs of runs until one is left; every round is cut into "threads"
+    //    equal slices of the output, whatever the number of runs
+    T* src = buffer;
+    T* dst = data;
+    int* splits = new int[threads];
+    while(numRuns > 1){
+        // 2a. where each slice starts in its pair of runs: computed before any item
+        //     is moved, as the binary search reads items of the neighbouring slices
+        runParallel(threads, [&](int id){
+            int sliceFrom = (int)((long long)n * id / threads);
+            int r = 0;
+            while(r + 2 <= numRuns && runs[r + 2] <= sliceFrom) r += 2;
+            splits[id] = 0;
+            if(r + 1 < numRuns){
+                int from = runs[r], mid = runs[r + 1], to = runs[r + 2];
+                splits[id] = mergeSplit(src + from, mid - from, src + mid, to - mid, sliceFrom - from, less);
+            }
+        });
+
+        // 2b. merge
+        runParallel(threads, [&](int id){
+            int sliceFrom = (int)((long long)n * id / threads);
+            int sliceTo = (int)((long long)n * (id + 1) / threads);
+            for(int r = 0; r < numRuns; r += 2){
+                int from = runs[r];
+                int mid = runs[r + 1];
+                int to = (r + 2 <= numRuns) ? runs[r + 2] : mid;
+                if(to <= sliceFrom || from >= sliceTo) continue;
+
+                int outFrom = std::max(from, sliceFrom);
+                int outTo = std::min(to, sliceTo);
+                if(r + 1 == numRuns){
+                    // odd run out: just move it
+                    for(int idx = outFrom; idx < outTo; idx++) dst[idx] = std::move(src[idx]);
+                    continue;
+                }
+                int i0 = (outFrom == from) ? 0 : splits[id];
+                int i1 = (outTo == to) ? mid - from : splits[id + 1];
+                int j0 = (outFrom - from) - i0;
+                int j1 = (outTo - from) - i1;
+                mergeRuns(src + from + i0, i1 - i0, src + mid + j0, j1 - j0, dst + outFrom, less);
+            }
+        });
+
+        int merged = 0;
+        for(int r = 0; r < numRuns; r += 2) runs[++merged] = (r + 2 <= numRuns) ? runs[r + 2] : runs[r + 1];
+        numRuns = merged;
+        std::swap(src, dst);
+    }
+
+    if(src != data){
+        runParallel(threads, [&](int id){
+            int from = (int)((long long)n * id / threads);
+            int to = (int)((long long)n * (id + 1) / threads);
+            for(int idx = from; idx < to; idx++) data[idx] = std::move(src[idx]);
+        });
+    }
+
+    runParallel(threads, [&](int id){
+        destroyRange(buffer, (int)((long long)n * id / threads), (int)((long long)n * (id + 1) / threads));
+    });
+    freeRaw(buffer, n);
+    delete[] splits;
+    delete[] runs;
+}
+
+template<class T, class Func>
+void parallelForRange(T* data, int n, Func func, int threads){
+    threads = sortLibThreadCount(threads);
+    if(threads > n) threads = (n > 0) ? n : 1;
+    runParallel(threads, [&](int id){
+        int from = (int)((long long)n * id / threads);
+        int to = (int)((long long)n * (id + 1) / threads);
+        for(int idx = from; idx < to; idx++) func(data[idx]);
+    });
+}
+
+#endif /* SORTLIB_H */
@@ -51,6 +51,46 @@ inline int maxHeapComparator(Point*& a, Point*& b){
     else if(ra > rb) return -1;
     else return 0;
 }
+/* squared distance to the origin (in Oxy):
+ *  same ordering as the sqrt-based comparators above, without any sqrt.
+ *  Use it as the key of KeyedItem<float, Point*> so that the distance is
+ *  computed once per push instead of twice per comparison.
+ */
+inline float pointSqDist(Point& p){
+    return p.getX()*p.getX() + p.getY()*p.getY();
+}
+inline float pointSqDist(Point*& p){
+    return p->getX()*p->getX() + p->getY()*p->getY();
+}
+
+inline int minHeapSqComparator(Point& a, Point& b){
+    float ra = pointSqDist(a);
+    float rb = pointSqDist(b);
+    if (ra < rb) return -1;
+    else if(ra > rb) return +1;
+    else return 0;
+}
+inline int maxHeapSqComparator(Point& a, Point& b){
+    float ra = pointSqDist(a);
+    float rb = pointSqDist(b);
+    if (ra < rb) return +1;
+    else if(ra > rb) return -1;
+    else return 0;
+}
+inline int minHeapSqComparator(Point*& a, Point*& b){
+    float ra = pointSqDist(a);
+    float rb = pointSqDist(b);
+    if (ra < rb) return -1;
+    else if(ra > rb) return +1;
+    else return 0;
+}
+inline int maxHeapSqComparator(Point*& a, Point*& b){
+    float ra = pointSqDist(a);
+    float rb = pointSqDist(b);
+    if (ra < rb) return +1;
+    else if(ra > rb) return -1;
+    else return 0;
+}
 ////////////////////////////////////////////////////////////
 inline string point2str(Point& point){
     stringstream os;
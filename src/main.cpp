@@ -5,6 +5,10 @@
 #include "test/tc_xmap.h"
 #include "test/tc_heap.h"
 #include "test/tc_compressor.h"
+#include "test/bench_heap.h"
+#include "test/bench_xarraylist.h"
+#include "test/bench_list.h"
+#include "test/bench_inventory.h"
 
 // Remember to comment out when submitting
 #include "test/tc_xarraylist.h"
@@ -25,13 +29,19 @@ void (*func_ptr[])() = {
     heapDemo2,
     heapDemo3,
     heapDemo4,
+    heapDemo5,
+    heapDemo6,
+    heapDemo7,
+    heapDemo8,
+    heapDemo9,
     tc_huffman1001,
     tc_huffman1002,
     tc_huffman1003,
     tc_huffman1004,
     tc_huffman1005,
     tc_compressor1001,
-    tc_compressor1002
+    tc_compressor1002,
+    tc_compressor1003
 };
 
 // Add array of test case names
@@ -47,26 +57,40 @@ const char* test_names[] = {
     "heapDemo2", 
     "heapDemo3",
     "heapDemo4",
+    "heapDemo5",
+    "heapDemo6",
+    "heapDemo7",
+    "heapDemo8",
+    "heapDemo9",
     "tc_huffman1001",
     "tc_huffman1002",
     "tc_huffman1003", 
     "tc_huffman1004",
     "tc_huffman1005",
     "tc_compressor1001",
-    "tc_compressor1002"
+    "tc_compressor1002",
+    "tc_compressor1003"
 };
 
-// void (*func_ptr[15])() = {
+// void (*func_ptr[23])() = {
 //     dlistDemo1,
 //     dlistDemo2,
 //     dlistDemo3,
 //     dlistDemo4,
 //     dlistDemo5,
 //     dlistDemo6,
+//     dlistDemo7,
+//     dlistDemo8,
 //     xlistDemo1,
 //     xlistDemo2,
 //     xlistDemo3,
 //     xlistDemo4,
+//     xlistDemo5,
+//     xlistDemo6,
+//     xlistDemo7,
+//     xlistDemo8,
+//     xlistDemo9,
+//     xlistDemo10,
 //     tc_inventory1001,
 //     tc_inventory1002,
 //     tc_inventory1003,
@@ -84,13 +108,22 @@ int main(int argc, char **argv)
     // cout << "Assignment-2" << endl;
     if (argc == 1) {
         // hashDemo1(); 
-        for (int i = 0; i < 18; i++) {
+        for (int i = 0; i < (int)(sizeof(func_ptr) / sizeof(func_ptr[0])); i++) {
             cout << "==========Running test case=======: " << i + 1 << endl;
             cout << "Test case name: " << test_names[i] << endl;
             cout << "===================================" << endl;
             run(i);
         }
     }
+    else if (string(argv[1]) == "bench") {
+        heapBenchmark();
+        // ./main bench <maxSize>: list sizes up to maxSize (e.g., 100000000)
+        int maxSize = (argc > 2) ? stoi(argv[2]) : 10000000;
+        xlistSearchBenchmark(maxSize);
+        xlistSortBenchmark(maxSize);
+        listMixedBenchmark(maxSize);
+        inventoryQueryBenchmark(maxSize);
+    }
     
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,58 @@
+#include "test/bench_heap.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include "heap/IHeap.h"
+#include "heap/Heap.h"
+#include "heap/PairingHeap.h"
+using namespace std;
+
+/*
+ * The same workload is run on every IHeap<int> implementation, through the
+ * interface only, so the numbers are comparable:
+ *  1. heapify n items
+ *  2. n mixed operations (2 push : 1 pop)
+ *  3. pop until empty
+ * The checksum of popped items must be the same for all implementations.
+ */
+static unsigned long long runHeapWorkload(IHeap<int>* heap, int* data, int n, double& elapsedMs){
+    auto start = chrono::steady_clock::now();
+    unsigned long long checksum = 0;
+
+    heap->heapify(data, n);
+    for(int idx = 0; idx < n; idx++){
+        if(idx % 3 == 2) checksum += heap->pop();
+        else heap->push(data[(idx * 7) % n]);
+    }
+    while(!heap->empty()) checksum = checksum * 31 + heap->pop();
+
+    auto stop = chrono::steady_clock::now();
+    elapsedMs = chrono::duration<double, milli>(stop - start).count();
+    return checksum;
+}
+
+void heapBenchmark(){
+    int sizes[] = {1000, 100000, 1000000};
+    default_random_engine engine(2025);
+    uniform_int_distribution<int> dist(0, 1000000000);
+
+    for(int n : sizes){
+        int* data = new int[n];
+        for(int idx = 0; idx < n; idx++) data[idx] = dist(engine);
+
+        IHeap<int>* heaps[] = { new Heap<int>(), new PairingHeap<int>() };
+        const char* names[] = { "Heap", "PairingHeap" };
+
+        for(int h = 0; h < 2; h++){
+            double elapsedMs = 0;
+            unsigned long long checksum = runHeapWorkload(heaps[h], data, n, elapsedMs);
+            cout << setw(12) << left << names[h]
+                 << " n=" << setw(8) << n
+                 << " time(ms)=" << setw(10) << fixed << setprecision(2) << elapsedMs
+                 << " checksum=" << checksum << endl;
+            delete heaps[h];
+        }
+        delete[] data;
+    }
+}
@@ -0,0 +1,103 @@
+#include "test/bench_inventory.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <string>
+#include "app/inventory.h"
+using namespace std;
+
+/*
+ * A catalog of n products, each with 8 attributes picked among 50 names, then
+ * range queries on one attribute (about 1% of the products match):
+ *  + build(ms): n calls of addProduct
+ *  + query(ms): average time of one query
+ *  + top10(ms): the same queries, limited to their first 10 products
+ *  + index(ms): createIndex on every attribute; indexed(ms): the same queries again
+ *  + dedup(ms): removeDuplicates (the catalog has none: every product is hashed, none removed)
+ *  + purge(ms): removeProduct on n / 10 random products, one at a time
+ */
+static void buildCatalog(InventoryManager& inventory, int n, default_random_engine& engine){
+    string names[50];
+    for(int idx = 0; idx < 50; idx++) names[idx] = "attr" + to_string(idx);
+
+    for(int idx = 0; idx < n; idx++){
+        List1D<InventoryAttribute> attributes;
+        int first = (int)(engine() % 50);
+        for(int k = 0; k < 8; k++){
+            attributes.add(InventoryAttribute(names[(first + 7 * k) % 50], (double)(engine() % 10000)));
+        }
+        inventory.addProduct(attributes, "product" + to_string(idx), (int)(engine() % 100));
+    }
+}
+
+void inventoryQueryBenchmark(int maxSize){
+    int sizes[] = {10000, 100000, 1000000};
+    for(int n : sizes){
+        if(n > maxSize) break;
+        default_random_engine engine(2025);
+        InventoryManager inventory;
+
+        auto start = chrono::steady_clock::now();
+        buildCatalog(inventory, n, engine);
+        auto stop = chrono::steady_clock::now();
+        double buildMs = chrono::duration<double, milli>(stop - start).count();
+
+        const int queries = 20;
+        double lows[queries];
+        for(int q = 0; q < queries; q++) lows[q] = (double)(engine() % 9000);
+
+        long long matches = 0;
+        start = chrono::steady_clock::now();
+        for(int q = 0; q < queries; q++){
+            List1D<string> result = inventory.query("attr" + to_string(q % 50), lows[q], lows[q] + 600, 10, q % 2 == 0);
+            matches += result.size();
+        }
+        stop = chrono::steady_clock::now();
+        double queryMs = chrono::duration<double, milli>(stop - start).count() / queries;
+
+        start = chrono::steady_clock::now();
+        for(int q = 0; q < queries; q++){
+            List1D<string> result = inventory.query("attr" + to_string(q % 50), lows[q], lows[q] + 600, 10, q % 2 == 0, 10);
+        }
+        stop = chrono::steady_clock::now();
+        double topMs = chrono::duration<double, milli>(stop - start).count() / queries;
+
+        start = chrono::steady_clock::now();
+        for(int idx = 0; idx < 50; idx++) inventory.createIndex("attr" + to_string(idx));
+        stop = chrono::steady_clock::now();
+        double indexMs = chrono::duration<double, milli>(stop - start).count();
+
+        long long indexedMatches = 0;
+        start = chrono::steady_clock::now();
+        for(int q = 0; q < queries; q++){
+            List1D<string> result = inventory.query("attr" + to_string(q % 50), lows[q], lows[q] + 600, 10, q % 2 == 0);
+            indexedMatches += result.size();
+        }
+        stop = chrono::steady_clock::now();
+        double indexedMs = chrono::duration<double, milli>(stop - start).count() / queries;
+        if(indexedMatches != matches) cout << "InventoryManager: indexed and scanned queries differ!" << endl;
+
+        start = chrono::steady_clock::now();
+        inventory.removeDuplicates();
+        stop = chrono::steady_clock::now();
+        double dedupMs = chrono::duration<double, milli>(stop - start).count();
+
+        start = chrono::steady_clock::now();
+        for(int idx = 0; idx < n / 10; idx++){
+            inventory.removeProduct((int)(engine() % inventory.size()));
+        }
+        stop = chrono::steady_clock::now();
+        double purgeMs = chrono::duration<double, milli>(stop - start).count();
+
+        cout << "InventoryManager     n=" << setw(9) << left << n
+             << " build(ms)=" << setw(10) << fixed << setprecision(2) << buildMs
+             << " query(ms)=" << setw(9) << queryMs
+             << " top10(ms)=" << setw(9) << topMs
+             << " index(ms)=" << setw(9) << indexMs
+             << " indexed(ms)=" << setw(9) << indexedMs
+             << " dedup(ms)=" << setw(9) << dedupMs
+             << " purge(ms)=" << setw(9) << purgeMs
+             << " matches/query=" << matches / queries << endl;
+    }
+}
@@ -0,0 +1,80 @@
+#include "test/bench_list.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include "list/IList.h"
+#include "list/XArrayList.h"
+#include "list/DLinkedList.h"
+#include "list/UnrolledLinkedList.h"
+#include "list/TreapList.h"
+using namespace std;
+
+/*
+ * The same workload is run on every IList<int> implementation, through the
+ * interface only, so the numbers are comparable:
+ *  1. n appends
+ *  2. "ops" mixed operations at random positions (1 add : 1 removeAt : 2 get)
+ *  3. a scan by index: get(0), get(1), ..., get(n-1)
+ * The checksum must be the same for all implementations.
+ */
+static unsigned long long runListWorkload(IList<int>* list, int n, int ops, double* elapsedMs){
+    default_random_engine engine(2025);
+    unsigned long long checksum = 0;
+
+    auto start = chrono::steady_clock::now();
+    for(int idx = 0; idx < n; idx++) list->add(idx);
+    auto stop = chrono::steady_clock::now();
+    elapsedMs[0] = chrono::duration<double, milli>(stop - start).count();
+
+    start = chrono::steady_clock::now();
+    for(int op = 0; op < ops; op++){
+        int index = (int)(engine() % (unsigned)list->size());
+        switch(op % 4){
+        case 0: list->add(index, op); break;
+        case 1: checksum += list->removeAt(index); break;
+        default: checksum = checksum * 31 + list->get(index); break;
+        }
+    }
+    stop = chrono::steady_clock::now();
+    elapsedMs[1] = chrono::duration<double, milli>(stop - start).count();
+
+    start = chrono::steady_clock::now();
+    for(int idx = 0; idx < list->size(); idx++) checksum += list->get(idx);
+    stop = chrono::steady_clock::now();
+    elapsedMs[2] = chrono::duration<double, milli>(stop - start).count();
+    return checksum;
+}
+
+void listMixedBenchmark(int maxSize){
+    int sizes[] = {1000, 10000, 100000, 1000000};
+    const char* names[] = {"XArrayList", "DLinkedList", "UnrolledLinkedList", "TreapList"};
+
+    for(int n : sizes){
+        if(n > maxSize) break;
+        int ops = 100000;
+        unsigned long long checksums[4];
+        for(int impl = 0; impl < 4; impl++){
+            // DLinkedList: every positional access walks O(n) nodes
+            if(impl == 1 && n > 100000){
+                cout << setw(20) << left << names[impl] << " n=" << setw(9) << n << " skipped (O(n) per operation)" << endl;
+                checksums[impl] = checksums[0];
+                continue;
+            }
+            IList<int>* list;
+            if(impl == 0) list = new XArrayList<int>();
+            else if(impl == 1) list = new DLinkedList<int>();
+            else if(impl == 2) list = new UnrolledLinkedList<int>();
+            else list = new TreapList<int>();
+
+            double elapsedMs[3];
+            checksums[impl] = runListWorkload(list, n, ops, elapsedMs);
+            delete list;
+            cout << setw(20) << left << names[impl] << " n=" << setw(9) << n
+                 << " append(ms)=" << setw(9) << fixed << setprecision(2) << elapsedMs[0]
+                 << " mixed(ms)=" << setw(10) << elapsedMs[1]
+                 << " scan(ms)=" << setw(9) << elapsedMs[2]
+                 << ((checksums[impl] == checksums[0]) ? "" : "  MISMATCH") << endl;
+        }
+    }
+}
@@ -0,0 +1,120 @@
+#include "test/bench_xarraylist.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <algorithm>
+#include "list/XArrayList.h"
+#include "util/SearchLib.h"
+using namespace std;
+
+/*
+ * contains() on XArrayList<T> (vectorized for int/float/double/char) against the
+ * scalar loop it replaced, on the same buffer:
+ *  - "miss": the value is absent, the whole list is scanned
+ *  - "hit" : the value is at a random position
+ * Small lists repeat the queries so every row scans about the same number of items.
+ */
+template<class T>
+static void runSearch(const char* typeName, int n, T absent){
+    XArrayList<T> list(0, 0, n);
+    default_random_engine engine(2025);
+    uniform_int_distribution<int> dist(0, 100);
+    for(int idx = 0; idx < n; idx++) list.add((T)dist(engine));
+
+    T* buffer = &list.get(0);
+    int queries = (n >= 100000000) ? 4 : (int)(400000000LL / n);
+    uniform_int_distribution<int> position(0, n - 1);
+    int* hitPositions = new int[queries];
+    for(int q = 0; q < queries; q++) hitPositions[q] = position(engine);
+
+    for(int mode = 0; mode < 2; mode++){
+        double elapsed[2];
+        long long found[2] = {0, 0};
+        for(int impl = 0; impl < 2; impl++){
+            auto start = chrono::steady_clock::now();
+            for(int q = 0; q < queries; q++){
+                // "hit": plant the searched value for this query only
+                int pos = (mode == 0) ? -1 : hitPositions[q];
+                T saved = (pos >= 0) ? buffer[pos] : absent;
+                if(pos >= 0) buffer[pos] = absent;
+
+                if(impl == 0) found[impl] += findFirst<T>(buffer, n, absent) >= 0;
+                else found[impl] += list.contains(absent);
+
+                if(pos >= 0) buffer[pos] = saved;
+            }
+            auto stop = chrono::steady_clock::now();
+            elapsed[impl] = chrono::duration<double, milli>(stop - start).count();
+        }
+        cout << setw(7) << left << typeName
+             << " n=" << setw(10) << n
+             << setw(5) << ((mode == 0) ? "miss" : "hit")
+             << " scalar(ms)=" << setw(10) << fixed << setprecision(2) << elapsed[0]
+             << " contains(ms)=" << setw(10) << elapsed[1]
+             << " speedup=" << setprecision(1) << elapsed[0] / elapsed[1] << "x"
+             << ((found[0] == found[1]) ? "" : "  MISMATCH") << endl;
+    }
+    delete[] hitPositions;
+}
+
+void xlistSearchBenchmark(int maxSize){
+    int sizes[] = {1000, 100000, 10000000, 100000000};
+    for(int n : sizes){
+        if(n > maxSize) break;
+        runSearch<int>("int", n, 1000);
+        runSearch<float>("float", n, 1000.0f);
+        runSearch<double>("double", n, 1000.0);
+        runSearch<char>("char", n, (char)127);
+    }
+}
+
+/*
+ * sort, stableSort and parallelSort (1, 2, 4, ... threads up to the number of
+ * hardware threads) on the same random ints; std::sort is the reference.
+ */
+void xlistSortBenchmark(int maxSize){
+    int sizes[] = {1000, 100000, 10000000, 100000000};
+    int hardware = (int)thread::hardware_concurrency();
+    if(hardware < 1) hardware = 1;
+
+    for(int n : sizes){
+        if(n > maxSize) break;
+        int* data = new int[n];
+        default_random_engine engine(2025);
+        uniform_int_distribution<int> dist(0, 1000000000);
+        for(int idx = 0; idx < n; idx++) data[idx] = dist(engine);
+
+        int* expected = new int[n];
+        for(int idx = 0; idx < n; idx++) expected[idx] = data[idx];
+        auto start = chrono::steady_clock::now();
+        std::sort(expected, expected + n);
+        double referenceMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        cout << setw(22) << left << "std::sort" << " n=" << setw(10) << n
+             << " time(ms)=" << fixed << setprecision(2) << referenceMs << endl;
+
+        for(int method = 0; method < 2 + 8; method++){
+            int threads = 1 << (method - 2);
+            if(method >= 2 && threads > hardware) break;
+
+            XArrayList<int> list(0, 0, n);
+            list.addAll(data, n);
+            start = chrono::steady_clock::now();
+            string name;
+            if(method == 0){ list.sort(); name = "sort"; }
+            else if(method == 1){ list.stableSort(); name = "stableSort"; }
+            else{ list.parallelSort(threads); name = "parallelSort(" + to_string(threads) + ")"; }
+            double elapsedMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+            bool ok = true;
+            for(int idx = 0; idx < n && ok; idx++) ok = list.get(idx) == expected[idx];
+            cout << setw(22) << left << name << " n=" << setw(10) << n
+                 << " time(ms)=" << setw(10) << fixed << setprecision(2) << elapsedMs
+                 << " vs std::sort=" << setprecision(2) << referenceMs / elapsedMs << "x"
+                 << (ok ? "" : "  WRONG ORDER") << endl;
+        }
+        delete[] expected;
+        delete[] data;
+    }
+}
@@ -1,6 +1,7 @@
 #include <iostream>
 #include <string>
 #include <sstream>
+#include <limits>
 #include "app/inventory_compressor.h"
 #include "app/inventory.h"
 
@@ -153,4 +154,40 @@ void tc_compressor1002() {
 
     cout << "Encoded Car: " << encodedCar << endl;
     cout << "Encoded Battery: " << encodedBattery << endl;
+}
+void tc_compressor1003() {
+    // values whose text is unusual: the Huffman table must cover every character of productToString
+    InventoryManager manager;
+
+    List1D<InventoryAttribute> probeAttrs;
+    probeAttrs.add(InventoryAttribute("offset", -3.25));
+    probeAttrs.add(InventoryAttribute("gain", numeric_limits<double>::quiet_NaN()));
+    manager.addProduct(probeAttrs, "Probe", 2);
+
+    List1D<InventoryAttribute> starAttrs;
+    starAttrs.add(InventoryAttribute("mass", 1.989e30));
+    starAttrs.add(InventoryAttribute("charge", -1e-7));
+    starAttrs.add(InventoryAttribute("tiny", -1e300));
+    manager.addProduct(starAttrs, "Star", 1);
+
+    InvCompressor compressor(&manager);
+    compressor.buildHuffman();
+
+    List1D<InventoryAttribute>* products[] = { &probeAttrs, &starAttrs };
+    string names[] = { "Probe", "Star" };
+    for (int i = 0; i < 2; i++) {
+        string productStr = compressor.productToString(*products[i], names[i]);
+        cout << "Product string: " << productStr << endl;
+        try {
+            string encoded = compressor.encodeHuffman(*products[i], names[i]);
+            List1D<InventoryAttribute> decodedAttrs;
+            string decodedName;
+            string decoded = compressor.decodeHuffman(encoded, decodedAttrs, decodedName);
+            cout << "Encoded " << encoded.size() << " bits, decoded "
+                 << (decoded == productStr ? "back to the same string" : "to: " + decoded) << endl;
+        }
+        catch (const exception &e) {
+            cout << "Encoding failed: " << e.what() << endl;
+        }
+    }
 }
\ No newline at end of file
@@ -2,6 +2,8 @@
 #include <iostream>
 #include <iomanip>
 #include "list/DLinkedList.h"
+#include "list/XArrayList.h"
+#include "hash/xMap.h"
 #include "util/Point.h"
 using namespace std;
 
@@ -104,3 +106,48 @@ void dlistDemo6(){
     cout << setw(25) << left << "After changing an item: ";
     list.println();
 }
+
+int dlistWordHash(string& word, int capacity){
+    int code = 0;
+    for(char ch: word) code = (code * 31 + ch) % capacity;
+    return code;
+}
+void dlistDemo7(){
+    // nodes from the per-thread pool instead of one malloc per node
+    DLinkedList<string, PoolAllocator> words;
+    words.add("to"); words.add("be"); words.add("or"); words.add("not"); words.add("to"); words.add("be");
+    words.println();
+
+    // everything below comes from one arena and is freed at once
+    Arena arena;
+    {
+        ArenaScope scope(arena);
+        xMap<string, int, ArenaAllocator> counts(&dlistWordHash);
+        for(string word: words){
+            if(counts.containsKey(word)) counts.get(word) += 1;
+            else counts.put(word, 1);
+        }
+        XArrayList<string, ArenaAllocator> order;
+        for(string word: words){
+            if(order.indexOf(word) < 0) order.add(word);
+        }
+        for(string word: order) cout << word << ": " << counts.get(word) << endl;
+    }
+    cout << "arena used: " << (arena.bytesUsed() > 0 ? "yes" : "no") << endl;
+    arena.release();
+}
+void dlistDemo8(){
+    DLinkedList<int> queue, urgent;
+    for(int i = 1; i <= 6; i++) queue.add(i);
+    urgent.add(100); urgent.add(200);
+
+    // the nodes are relinked: no node is copied or allocated
+    queue.splice(1, urgent);
+    cout << "queue: " << queue.toString() << ", urgent: " << urgent.toString() << endl;
+
+    DLinkedList<int> later = queue.splitAt(5);
+    cout << "queue: " << queue.toString() << ", later: " << later.toString() << endl;
+
+    later.concat(std::move(queue));
+    cout << "later: " << later.toString() << ", queue empty: " << queue.empty() << endl;
+}
@@ -2,6 +2,8 @@
  #include <string>
  #include <sstream>
  #include "heap/Heap.h"
+ #include "heap/KeyedItem.h"
+ #include "heap/PairingHeap.h"
  #include "util/Point.h"
  #include "util/sampleFunc.h"
  
@@ -137,4 +139,122 @@ void heapDemo4() {
     list.println();
 }
  
- 
\ No newline at end of file
+ 
+void heapDemo5(){
+    Point* array[] = {
+        new Point(13.1, 12.4), new Point(5.5, 4.5), new Point(15.5, 14.5),
+        new Point(23.1, 12.4), new Point(35.5, 14.5), new Point(5.5, 34.5)
+    };
+    // key = squared distance, computed once per push
+    Heap<KeyedItem<float, Point*>> minHeap;
+    Heap<KeyedItem<float, Point*>> maxHeap(&KeyedItem<float, Point*>::maxComparator);
+    for(int idx=0; idx < 6; idx++){
+        minHeap.push(KeyedItem<float, Point*>(pointSqDist(array[idx]), array[idx]));
+        maxHeap.push(KeyedItem<float, Point*>(pointSqDist(array[idx]), array[idx]));
+    }
+
+    cout << "Nearest first: ";
+    while(!minHeap.empty()){
+        KeyedItem<float, Point*> keyed = minHeap.pop();
+        cout << point2str(keyed.item) << " ";
+    }
+    cout << endl;
+    cout << "Farthest first: ";
+    while(!maxHeap.empty()){
+        KeyedItem<float, Point*> keyed = maxHeap.pop();
+        cout << point2str(keyed.item) << " ";
+    }
+    cout << endl;
+
+    Heap<Point*> sqHeap(&minHeapSqComparator);
+    for(int idx=0; idx < 6; idx++) sqHeap.push(array[idx]);
+    cout << "Min Heap (squared): " << sqHeap.toString(&point2str) << endl;
+
+    for(int idx=0; idx < 6; idx++) delete array[idx];
+}
+
+void heapDemo6(){
+    //build in-place from a list: the list's buffer is adopted
+    XArrayList<int> list;
+    int values[] = {50, 20, 15, 10, 8, 6, 7, 23};
+    for (int v : values) list.add(v);
+    Heap<int> heap(std::move(list));
+    cout << "Adopted: " << heap.toString() << " (list size: " << list.size() << ")" << endl;
+
+    //bulk push
+    XArrayList<int> more;
+    for (int v = 30; v > 0; v -= 3) more.add(v);
+    heap.pushAll(more.begin(), more.end());
+    cout << "After pushAll: " << heap.toString() << endl;
+
+    //meld
+    Heap<int> other;
+    int extra[] = {1, 100, 2};
+    other.pushAll(extra, 3);
+    heap.meld(std::move(other));
+    cout << "After meld: size=" << heap.size() << ", other size=" << other.size() << endl;
+
+    cout << "Popped: ";
+    while (!heap.empty()) cout << heap.pop() << " ";
+    cout << endl;
+}
+
+void heapDemo7(){
+    PairingHeap<int> heap;
+    int array[] = {50, 20, 15, 10, 8, 6, 7, 23};
+    heap.heapify(array, 8);
+    PairingHeap<int>::Node* node = heap.insert(40);
+    cout << "Pairing heap: " << heap.toString() << endl;
+
+    heap.decreaseKey(node, 1);
+    cout << "After decreaseKey(40 -> 1), peek: " << heap.peek() << endl;
+
+    PairingHeap<int> other;
+    other.push(3);
+    other.push(0);
+    heap.meld(std::move(other));
+    heap.remove(15);
+    cout << "After meld and remove(15): ";
+    while (!heap.empty()) cout << heap.pop() << " ";
+    cout << endl;
+}
+
+void heapDemo8(){
+    int array[] = {50, 20, 15, 10, 8, 6, 7, 23};
+    Heap<int> maxHeap(maxHeapComparator);
+    maxHeap.heapify(array, 8);
+
+    cout << "Priority order: ";
+    for(Heap<int>::OrderedIterator it = maxHeap.orderedBegin(); it != maxHeap.orderedEnd(); it++)
+        cout << *it << " ";
+    cout << endl;
+
+    XArrayList<int> top3;
+    maxHeap.top(3, top3);
+    cout << "Top 3: " << top3.toString() << endl;
+    cout << "Heap unchanged: " << maxHeap.toString() << endl;
+}
+
+void heapDemo9(){
+    //meld heaps ordered by different comparators: items follow the receiving heap
+    int minArray[] = {5};
+    int maxArray[] = {1, 9, 3, 7};
+
+    Heap<int> minHeap(minHeapComparator);
+    Heap<int> maxHeap(maxHeapComparator);
+    minHeap.heapify(minArray, 1);
+    maxHeap.heapify(maxArray, 4);
+    minHeap.meld(std::move(maxHeap));
+    cout << "Heap meld (min <- max): ";
+    while (!minHeap.empty()) cout << minHeap.pop() << " ";
+    cout << endl;
+
+    PairingHeap<int> minPairing(minHeapComparator);
+    PairingHeap<int> maxPairing(maxHeapComparator);
+    minPairing.heapify(minArray, 1);
+    maxPairing.heapify(maxArray, 4);
+    minPairing.meld(std::move(maxPairing));
+    cout << "PairingHeap meld (min <- max): ";
+    while (!minPairing.empty()) cout << minPairing.pop() << " ";
+    cout << " (other size: " << maxPairing.size() << ")" << endl;
+}
@@ -167,4 +167,329 @@ void tc_inventory1006(){
     inventory.removeDuplicates();
     cout << "\nAfter removing duplicates:" << endl;
     cout << inventory.toString() << endl;
-}
\ No newline at end of file
+}
+
+// runs the same queries on "indexed" and on a copy without the index
+static void compareIndexedQueries(const InventoryManager &indexed, const string &attributeName) {
+    InventoryManager scanned = indexed;
+    scanned.dropIndex(attributeName);
+    double ranges[][2] = { {0, 100}, {10, 20}, {15, 15}, {21, 29}, {-5, 5} };
+    int minQuantities[] = { 0, 25 };
+    for (auto &range : ranges) {
+        for (int minQuantity : minQuantities) {
+            for (int ascending = 1; ascending >= 0; ascending--) {
+                List1D<string> withIndex = indexed.query(attributeName, range[0], range[1], minQuantity, ascending);
+                List1D<string> withScan = scanned.query(attributeName, range[0], range[1], minQuantity, ascending);
+                cout << attributeName << " in [" << range[0] << ", " << range[1] << "], quantity >= " << minQuantity
+                     << (ascending ? ", ascending: " : ", descending: ") << withIndex
+                     << (withIndex.toString() == withScan.toString() ? " (same as scan)" : " (DIFFERS from scan)") << endl;
+            }
+        }
+    }
+}
+
+void tc_inventory1007() {
+    // query with and without an index on "weight"
+    string names[] = { "Bolt", "Nut", "Gear", "Spring", "Axle", "Cam" };
+    double weights[] = { 15, 10, 20, 15, 25, 15 };
+    int quantities[] = { 30, 50, 20, 30, 40, 10 };
+    InventoryManager inventory;
+    for (int i = 0; i < 6; i++) {
+        List1D<InventoryAttribute> attributes;
+        attributes.add(InventoryAttribute("weight", weights[i]));
+        attributes.add(InventoryAttribute("height", 100 + i));
+        inventory.addProduct(attributes, names[i], quantities[i]);
+    }
+    List1D<InventoryAttribute> noWeight;
+    noWeight.add(InventoryAttribute("height", 7));
+    inventory.addProduct(noWeight, "Washer", 90);
+
+    cout << "hasIndex(weight) before createIndex: " << inventory.hasIndex("weight") << endl;
+    inventory.createIndex("weight");
+    cout << "hasIndex(weight): " << inventory.hasIndex("weight")
+         << ", hasIndex(color): " << inventory.hasIndex("color") << endl;
+    compareIndexedQueries(inventory, "weight");
+
+    // the index follows updateQuantity and removeProduct
+    inventory.updateQuantity(1, 5);  // Nut
+    inventory.updateQuantity(5, 60); // Cam
+    inventory.removeProduct(0);      // Bolt
+    cout << "\nAfter updateQuantity(Nut: 5, Cam: 60) and removeProduct(Bolt):" << endl;
+    compareIndexedQueries(inventory, "weight");
+
+    // a product with "weight" twice: query falls back to the scan
+    List1D<InventoryAttribute> twice;
+    twice.add(InventoryAttribute("weight", 12));
+    twice.add(InventoryAttribute("weight", 18));
+    inventory.addProduct(twice, "Pair", 35);
+    cout << "\nAfter adding Pair (weight 12 and 18):" << endl;
+    compareIndexedQueries(inventory, "weight");
+
+    inventory.dropIndex("weight");
+    cout << "hasIndex(weight) after dropIndex: " << inventory.hasIndex("weight") << endl;
+}
+
+void tc_inventory1008() {
+    // query(..., limit): ties on value and on quantity, in both orders
+    string names[] = { "P0", "P1", "P2", "P3", "P4", "P5", "P6" };
+    double weights[] = { 10, 20, 10, 10, 20, 30, 10 };
+    int quantities[] = { 5, 5, 7, 5, 5, 1, 7 };
+    InventoryManager inventory;
+    for (int i = 0; i < 7; i++) {
+        List1D<InventoryAttribute> attributes;
+        attributes.add(InventoryAttribute("weight", weights[i]));
+        inventory.addProduct(attributes, names[i], quantities[i]);
+    }
+
+    cout << "Full query, ascending: " << inventory.query("weight", 0, 100, 0, true) << endl;
+    cout << "Full query, descending: " << inventory.query("weight", 0, 100, 0, false) << endl;
+    int limits[] = { 0, 1, 3, 4, 6, 7, 100 };
+    for (int limit : limits) {
+        cout << "limit " << limit << ", ascending: " << inventory.query("weight", 0, 100, 0, true, limit)
+             << ", descending: " << inventory.query("weight", 0, 100, 0, false, limit) << endl;
+    }
+    cout << "limit 2, quantity >= 6, ascending: " << inventory.query("weight", 0, 100, 6, true, 2) << endl;
+    cout << "limit 2, weight in [15, 25], descending: " << inventory.query("weight", 15, 25, 0, false, 2) << endl;
+
+    inventory.createIndex("weight");
+    cout << "Indexed, limit 3, ascending: " << inventory.query("weight", 0, 100, 0, true, 3)
+         << ", descending: " << inventory.query("weight", 0, 100, 0, false, 3) << endl;
+}
+
+// products by index (getProductName, getProductQuantity, getProductAttributes)
+static void printProducts(const InventoryManager &inventory) {
+    cout << "size " << inventory.size() << ":";
+    for (int i = 0; i < inventory.size(); i++) {
+        cout << " " << inventory.getProductName(i) << "(" << inventory.getProductQuantity(i)
+             << ", " << inventory.getProductAttributes(i) << ")";
+    }
+    cout << endl;
+}
+
+static InventoryManager sampleInventory(int numProducts) {
+    InventoryManager inventory;
+    for (int i = 0; i < numProducts; i++) {
+        List1D<InventoryAttribute> attributes;
+        attributes.add(InventoryAttribute("weight", 10 * (i % 4)));
+        inventory.addProduct(attributes, "P" + to_string(i), i);
+    }
+    return inventory;
+}
+
+void tc_inventory1009() {
+    // removing while iterating: the removed products stay invisible
+    InventoryManager inventory = sampleInventory(8);
+    List1D<InventoryAttribute> copyOfP1;
+    copyOfP1.add(InventoryAttribute("weight", 10));
+    inventory.addProduct(copyOfP1, "P1", 100); // a duplicate of P1
+    printProducts(inventory);
+
+    for (InventoryManager::Iterator it = inventory.begin(); it != inventory.end(); it++) {
+        if (it.quantity() % 3 == 0) {
+            it.remove(); // P0, P3, P6
+        }
+        else if (it.name() == "P4") {
+            it.updateQuantity(40);
+        }
+    }
+    cout << "After removing P0, P3, P6 and setting P4 to 40, while iterating:" << endl;
+    printProducts(inventory);
+    cout << "query(weight, 0, 30, 0): " << inventory.query("weight", 0, 30, 0, true) << endl;
+    cout << "getProductNames: " << inventory.getProductNames() << ", getQuantities: " << inventory.getQuantities() << endl;
+    cout << inventory.toString() << endl;
+
+    cout << "Iterating again:";
+    for (InventoryManager::Iterator it = inventory.begin(); it != inventory.end(); it++) {
+        cout << " " << it.name() << "=" << it.quantity();
+    }
+    cout << endl;
+
+    inventory.removeDuplicates();
+    cout << "After removeDuplicates:" << endl;
+    printProducts(inventory);
+    inventory.compact();
+    cout << "After compact:" << endl;
+    printProducts(inventory);
+
+    // compactIfSparse: rows are reclaimed once more than MAX_REMOVED_PERCENT % are removed
+    InventoryColumns table;
+    List1D<InventoryAttribute> attributes;
+    attributes.add(InventoryAttribute("weight", 1));
+    for (int r = 0; r < 8; r++) {
+        table.addRow(attributes, "R" + to_string(r), r);
+    }
+    for (int r = 0; r < 3; r++) {
+        table.removeRow(r);
+        table.compactIfSparse();
+        cout << "removed " << r + 1 << " of 8: size " << table.size() << ", rowCount " << table.rowCount() << endl;
+    }
+}
+
+void tc_inventory1010() {
+    // removeProducts: a batch, in any order, with repeated indices
+    InventoryManager inventory = sampleInventory(8);
+    int indicesArray[] = { 6, 1, 6, 3, 1 };
+    List1D<int> indices(indicesArray, 5);
+    inventory.removeProducts(indices);
+    cout << "After removeProducts([6, 1, 6, 3, 1]):" << endl;
+    printProducts(inventory);
+
+    // an invalid index: nothing is removed
+    int invalidArray[] = { 0, 2, 5 };
+    List1D<int> invalid(invalidArray, 3);
+    try {
+        inventory.removeProducts(invalid);
+        cout << "No exception for index 5" << endl;
+    }
+    catch (const out_of_range &e) {
+        cout << "removeProducts([0, 2, 5]) threw: " << e.what() << endl;
+    }
+    int negativeArray[] = { -1 };
+    try {
+        inventory.removeProducts(List1D<int>(negativeArray, 1));
+        cout << "No exception for index -1" << endl;
+    }
+    catch (const out_of_range &e) {
+        cout << "removeProducts([-1]) threw: " << e.what() << endl;
+    }
+    printProducts(inventory);
+
+    inventory.removeProducts(List1D<int>());
+    inventory.removeProduct(0);
+    cout << "After removeProducts([]) and removeProduct(0):" << endl;
+    printProducts(inventory);
+}
+
+void tc_inventory1011() {
+    // getProductAttributesView, getProductNameView: the same data as the copying getters
+    InventoryManager inventory = sampleInventory(3);
+    List1D<InventoryAttribute> attributes;
+    attributes.add(InventoryAttribute("height", 2.5));
+    attributes.add(InventoryAttribute("weight", -7));
+    attributes.add(InventoryAttribute("height", 4));
+    inventory.addProduct(attributes, "Box", 9);
+    inventory.removeProduct(0); // a tombstone: the views follow rowOf too
+
+    for (int i = 0; i < inventory.size(); i++) {
+        AttributeRowView view = inventory.getProductAttributesView(i);
+        cout << inventory.getProductNameView(i) << ": " << view.size() << " attribute(s):";
+        for (int k = 0; k < view.size(); k++) {
+            cout << " " << view.name(k) << "=" << to_string(view.value(k));
+        }
+        cout << ", get(0): " << view.get(0) << ", toList: " << view.toList()
+             << (view.toList().toString() == inventory.getProductAttributes(i).toString() ? " (same as getProductAttributes)" : " (DIFFERS)")
+             << endl;
+    }
+
+    AttributeRowView box = inventory.getProductAttributesView(inventory.size() - 1);
+    int invalid[] = { -1, box.size() };
+    for (int k : invalid) {
+        try {
+            box.name(k);
+            cout << "No exception for name(" << k << ")" << endl;
+        }
+        catch (const out_of_range &e) {
+            cout << "name(" << k << ") threw: " << e.what() << endl;
+        }
+    }
+    try {
+        box.value(box.size());
+        cout << "No exception for value(" << box.size() << ")" << endl;
+    }
+    catch (const out_of_range &e) {
+        cout << "value(" << box.size() << ") threw: " << e.what() << endl;
+    }
+    try {
+        inventory.getProductAttributesView(inventory.size());
+        cout << "No exception for getProductAttributesView(size())" << endl;
+    }
+    catch (const out_of_range &e) {
+        cout << "getProductAttributesView(size()) threw: " << e.what() << endl;
+    }
+    try {
+        inventory.getProductNameView(-1);
+        cout << "No exception for getProductNameView(-1)" << endl;
+    }
+    catch (const out_of_range &e) {
+        cout << "getProductNameView(-1) threw: " << e.what() << endl;
+    }
+}
+
+void tc_inventory1012() {
+    // moves: the data is taken, and the moved-from object is empty but usable
+    int arr[] = { 1, 2, 3 };
+    List1D<int> list(arr, 3);
+    List1D<int> moved(std::move(list));
+    cout << "List1D moved: " << moved << ", moved-from: " << list << " (size " << list.size() << ")" << endl;
+    list.add(4);
+    cout << "moved-from after add(4): " << list << endl;
+    list = std::move(moved);
+    cout << "move-assigned: " << list << ", moved-from: " << moved << " (size " << moved.size() << ")" << endl;
+    moved = list;
+    cout << "moved-from after copy assignment: " << moved << endl;
+    try {
+        List1D<int> empty(std::move(moved));
+        moved.get(0);
+        cout << "No exception for get(0)" << endl;
+    }
+    catch (const out_of_range &e) {
+        cout << "moved-from get(0) threw: " << e.what() << endl;
+    }
+
+    List1D<int> rows[] = { List1D<int>(arr, 2), List1D<int>(arr, 3) };
+    List2D<int> matrix(rows, 2);
+    List2D<int> movedMatrix(std::move(matrix));
+    cout << "List2D moved: " << movedMatrix << ", moved-from: " << matrix << " (rows " << matrix.rows() << ")" << endl;
+    matrix.setRow(0, List1D<int>(arr, 1));
+    cout << "moved-from after setRow(0, [1]): " << matrix << endl;
+    matrix = std::move(movedMatrix);
+    cout << "move-assigned: " << matrix << ", moved-from: " << movedMatrix << " (rows " << movedMatrix.rows() << ")" << endl;
+    movedMatrix = matrix;
+    cout << "moved-from after copy assignment: " << movedMatrix << endl;
+
+    InventoryManager inventory = sampleInventory(3);
+    InventoryManager movedInventory(std::move(inventory));
+    cout << "InventoryManager moved: size " << movedInventory.size() << ", moved-from: size " << inventory.size()
+         << ", " << inventory.getProductNames() << endl;
+    inventory.addProduct(List1D<InventoryAttribute>(), "Extra", 1);
+    cout << "moved-from after addProduct: " << inventory.getProductNames() << endl;
+    inventory = std::move(movedInventory);
+    cout << "move-assigned: " << inventory.getProductNames() << ", moved-from: size " << movedInventory.size() << endl;
+    movedInventory = inventory;
+    cout << "moved-from after copy assignment: " << movedInventory.getProductNames() << endl;
+
+    // merge and split return and assign by move
+    InventoryManager section1, section2;
+    InventoryManager::merge(inventory, sampleInventory(2)).split(section1, section2, 0.5);
+    cout << "merge then split: " << section1.getProductNames() << " + " << section2.getProductNames() << endl;
+}
+
+void tc_inventory1013() {
+    // setRow on existing rows: the new cells go to the overflow area until the matrix is compacted
+    int arr[] = { 1, 2, 3, 4, 5, 6 };
+    List1D<int> rows[] = { List1D<int>(arr, 2), List1D<int>(arr + 2, 2), List1D<int>(arr + 4, 2) };
+    List2D<int> matrix(rows, 3);
+    cout << "Initial: " << matrix << endl;
+    for (int round = 1; round <= 6; round++) {
+        int row = round % 3;
+        List1D<int> newRow;
+        for (int j = 0; j < round; j++) {
+            newRow.add(10 * round + j);
+        }
+        matrix.setRow(row, newRow);
+        cout << "setRow(" << row << ", " << newRow << "): " << matrix
+             << ", get(" << row << ", " << round - 1 << ") = " << matrix.get(row, round - 1) << endl;
+    }
+    matrix.setRow(1, List1D<int>());
+    cout << "setRow(1, []): " << matrix << ", getRow(1): " << matrix.getRow(1) << endl;
+    matrix.setRow(3, List1D<int>(arr, 1));
+    List2D<int> copy = matrix;
+    cout << "After setRow(3, [1]): " << matrix << ", copy: " << copy << endl;
+    try {
+        matrix.get(1, 0);
+        cout << "No exception for get(1, 0)" << endl;
+    }
+    catch (const out_of_range &e) {
+        cout << "get(1, 0) threw: " << e.what() << endl;
+    }
+}
@@ -3,6 +3,10 @@
 #include <iostream>
 #include <iomanip>
 #include "list/XArrayList.h"
+#include "list/SmallXArrayList.h"
+#include "list/SegmentedList.h"
+#include "list/UnrolledLinkedList.h"
+#include "list/TreapList.h"
 #include "util/Point.h"
 using namespace std;
 
@@ -72,3 +76,109 @@ void xlistDemo4(){
     
     delete p1; delete p2;
 }
+
+void xlistDemo5(){
+    SmallXArrayList<int, 4> list;
+    for(int i = 0; i < 4; i++) list.add(i * i);
+    cout << list.toString() << (list.isInline() ? " (inline)" : " (heap)") << endl;
+
+    list.add(0, -1);
+    cout << list.toString() << (list.isInline() ? " (inline)" : " (heap)") << endl;
+
+    IList<int>* pList = &list;
+    cout << "removeAt(2): " << pList->removeAt(2) << ", indexOf(9): " << pList->indexOf(9) << endl;
+}
+
+void xlistDemo6(){
+    XArrayList<int> list;
+    int head[] = {1, 2, 3};
+    list.addAll(head, 3);
+    int middle[] = {10, 20, 30, 40};
+    list.insertRange(1, middle, middle + 4);
+    list.println();                 // [1, 10, 20, 30, 40, 2, 3]
+
+    list.removeRange(2, 4);
+    list.println();                 // [1, 10, 40, 2, 3]
+
+    int removed = list.removeIf([](int& item){ return item % 2 == 0; });
+    cout << "removeIf(even): " << removed << " removed, " << list.toString() << endl;
+
+    // removing while iterating does not shift the tail on every remove
+    for(int i = 0; i < 10; i++) list.add(i);
+    for(XArrayList<int>::Iterator it = list.begin(); it != list.end(); it++){
+        if(*it < 5) it.remove();
+    }
+    list.println();
+}
+
+void xlistDemo7(){
+    XArrayList<int> list;
+    int items[] = {42, 7, 19, 7, 3, 88, 19, 1};
+    list.addAll(items, 8);
+
+    list.sort();
+    list.println();                 // [1, 3, 7, 7, 19, 19, 42, 88]
+
+    // descending, with a Heap-style comparator
+    list.sort([](int& lhs, int& rhs){ return rhs - lhs; });
+    list.println();
+
+    // stable: points with the same distance to the origin keep their order
+    XArrayList<Point> points;
+    points.add(Point(3, 4));
+    points.add(Point(0, 1));
+    points.add(Point(4, 3));
+    points.add(Point(1, 0));
+    points.stableSort([](Point& lhs, Point& rhs){
+        float delta = lhs.radius() - rhs.radius();
+        return (delta < 0) ? -1 : (delta > 0 ? 1 : 0);
+    });
+    points.println();
+
+    list.parallelForEach([](int& item){ item *= 10; }, 2);
+    list.parallelSort(2);
+    list.println();
+}
+
+void xlistDemo8(){
+    // chunks of 4 items
+    SegmentedList<string, 2> log;
+    log.add("boot");
+    string& first = log.get(0);
+
+    for(int i = 1; i <= 10; i++) log.add("event-" + to_string(i));
+    // appending never moves the items: "first" is still valid
+    cout << "first: " << first << ", size: " << log.size() << ", chunks: " << log.chunkCount() << endl;
+
+    log.add(1, "config");
+    log.removeAt(log.size() - 1);
+    log.println();
+}
+
+void xlistDemo9(){
+    // nodes of (at most) 4 items, found by position in O(log n)
+    UnrolledLinkedList<int, 4> list;
+    for(int i = 0; i < 10; i++) list.add(i * i);
+    list.add(3, -1);
+    list.removeAt(0);
+    cout << "size: " << list.size() << ", nodes: " << list.nodeCount() << ", get(5): " << list.get(5) << endl;
+
+    for(UnrolledLinkedList<int, 4>::Iterator it = list.begin(); it != list.end(); it++){
+        if(*it % 2 == 1) it.remove();
+    }
+    list.println();
+}
+
+void xlistDemo10(){
+    TreapList<string> playlist;
+    for(int i = 1; i <= 6; i++) playlist.add("track-" + to_string(i));
+    playlist.add(2, "jingle");
+    cout << "get(2): " << playlist.get(2) << ", removed: " << playlist.removeAt(0) << endl;
+
+    // move the second half to the front: no item is copied
+    TreapList<string> secondHalf;
+    playlist.splitAt(playlist.size() / 2, secondHalf);
+    secondHalf.concat(playlist);
+    cout << "size: " << secondHalf.size() << ", empty: " << playlist.empty() << endl;
+    secondHalf.println();
+}